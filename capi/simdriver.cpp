@@ -0,0 +1,565 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// simdriver.cpp
+
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "simdriver.h"
+#include "AgentModel.h"
+#include "Reflection.h"
+
+using namespace agent_model;
+
+
+// layout contract of the header
+static_assert(SIMDRIVER_NOT == NOT && SIMDRIVER_NOL == NOL && SIMDRIVER_NOS == NOS && SIMDRIVER_NOH == NOH
+              && SIMDRIVER_NOA == NOA, "array lengths of the C interface do not match the interface.");
+static_assert(sizeof(simdriver_subconscious) == sizeof(Subconscious)
+              && offsetof(simdriver_subconscious, a) == offsetof(Subconscious, a)
+              && offsetof(simdriver_subconscious, dPsi) == offsetof(Subconscious, dPsi)
+              && offsetof(simdriver_subconscious, kappa) == offsetof(Subconscious, kappa)
+              && offsetof(simdriver_subconscious, pedal) == offsetof(Subconscious, pedal)
+              && offsetof(simdriver_subconscious, steering) == offsetof(Subconscious, steering),
+              "simdriver_subconscious does not match the interface.");
+
+
+namespace simdriver {
+
+    /**
+     * @brief Persistent worker threads, which step contiguous ranges of the agents
+     * The threads are started on the first parallel step and wait for the next step, so a step only costs a wake-up
+     * of the threads instead of their creation. The calling thread steps the first range.
+     */
+    class Workers {
+
+        std::vector<std::thread> _threads{};            //!< The worker threads (the calling thread is not included)
+        std::vector<std::exception_ptr> _errors{};      //!< The errors of the last step (per range)
+        std::mutex _mutex{};                            //!< The mutex of the step data
+        std::condition_variable _start{};               //!< Signals the start of a step to the workers
+        std::condition_variable _done{};                //!< Signals the end of the step to the calling thread
+
+        std::vector<AgentModel> *_agents = nullptr;     //!< The agents of the step
+        double _time = 0.0;                             //!< The simulation time of the step
+        unsigned long _generation = 0;                  //!< The step counter
+        unsigned int _pending = 0;                      //!< The number of workers which have not finished the step
+        bool _stop = false;                             //!< Flag to stop the workers
+
+    public:
+
+        Workers() = default;
+
+        Workers(const Workers &) = delete;
+        Workers &operator=(const Workers &) = delete;
+
+
+        /**
+         * Destructor, stops the workers
+         */
+        ~Workers() {
+
+            stop();
+
+        }
+
+
+        /**
+         * Steps the agents with the given number of threads (including the calling thread)
+         * @param agents The agents
+         * @param time The simulation time
+         * @param threads The number of threads
+         */
+        void step(std::vector<AgentModel> &agents, double time, unsigned int threads) {
+
+            // (re)start workers
+            if (_threads.size() + 1 != threads) {
+
+                stop();
+
+                _errors.assign(threads, nullptr);
+                for (unsigned int i = 1; i < threads; ++i)
+                    _threads.emplace_back(&Workers::loop, this, i, _generation);
+
+            }
+
+            // publish step
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _agents = &agents;
+                _time = time;
+                _pending = threads - 1;
+                ++_generation;
+                std::fill(_errors.begin(), _errors.end(), nullptr);
+            }
+
+            _start.notify_all();
+
+            // first range in the calling thread
+            run(0);
+
+            // wait for workers
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _done.wait(lock, [this]() { return _pending == 0; });
+            }
+
+            // rethrow first error
+            for (auto &e : _errors) {
+                if (e)
+                    std::rethrow_exception(e);
+            }
+
+        }
+
+
+    protected:
+
+        /**
+         * Steps the range of the given worker and stores the error
+         * @param i Index of the range
+         */
+        void run(unsigned int i) {
+
+            auto n = _agents->size();
+            auto threads = _errors.size();
+
+            try {
+
+                for (size_t k = i * n / threads; k < (i + 1) * n / threads; ++k)
+                    (*_agents)[k].step(_time);
+
+            } catch (...) {
+
+                _errors[i] = std::current_exception();
+
+            }
+
+        }
+
+
+        /**
+         * Worker loop, waits for the next step and steps the range
+         * @param i Index of the range
+         * @param generation The step counter at the start of the worker
+         */
+        void loop(unsigned int i, unsigned long generation) {
+
+            while (true) {
+
+                // wait for next step
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _start.wait(lock, [this, generation]() { return _stop || _generation != generation; });
+
+                    if (_stop)
+                        return;
+
+                    generation = _generation;
+                }
+
+                run(i);
+
+                // signal end of step
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (--_pending == 0)
+                    _done.notify_one();
+
+            }
+
+        }
+
+
+        /**
+         * Stops and joins the workers
+         */
+        void stop() {
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stop = true;
+            }
+
+            _start.notify_all();
+            for (auto &t : _threads)
+                t.join();
+
+            _threads.clear();
+            _stop = false;
+
+        }
+
+    };
+
+}
+
+
+/**
+ * @brief The pool of agents
+ */
+struct simdriver_pool {
+    std::vector<AgentModel> agents;   //!< The agents
+    simdriver::Workers workers{};     //!< The worker threads of the parallel steps
+};
+
+
+namespace {
+
+    thread_local std::string lastError{}; //!< The message of the last error of the thread
+
+
+    /**
+     * Runs the function and converts exceptions into error codes
+     */
+    template<typename F>
+    int guard(F fnc) {
+
+        try {
+
+            fnc();
+            lastError.clear();
+            return SIMDRIVER_OK;
+
+        } catch (std::out_of_range &e) {
+            lastError = e.what();
+            return SIMDRIVER_ERROR_RANGE;
+        } catch (std::invalid_argument &e) {
+            lastError = e.what();
+            return SIMDRIVER_ERROR_ARGUMENT;
+        } catch (std::exception &e) {
+            lastError = e.what();
+            return SIMDRIVER_ERROR_INTERNAL;
+        } catch (...) {
+            lastError = "unknown error.";
+            return SIMDRIVER_ERROR_INTERNAL;
+        }
+
+    }
+
+
+    /**
+     * Checks the pool and the range of agents
+     */
+    void check(const simdriver_pool *pool, const void *data, uint32_t first, uint32_t count) {
+
+        if (pool == nullptr)
+            throw std::invalid_argument("pool must not be null.");
+
+        if (data == nullptr && count != 0)
+            throw std::invalid_argument("buffer must not be null.");
+
+        if ((uint64_t) first + count > pool->agents.size())
+            throw std::out_of_range("agent range exceeds the size of the pool.");
+
+    }
+
+
+    /**
+     * Returns the field table of the exchanged struct
+     */
+    void table(simdriver_struct type, const reflection::Field *&fields, unsigned int &count) {
+
+        using namespace reflection;
+
+        switch (type) {
+            case SIMDRIVER_INPUT:
+                fields = FieldTable<Input>::fields;
+                count = FieldTable<Input>::count;
+                return;
+            case SIMDRIVER_STATE:
+                fields = FieldTable<State>::fields;
+                count = FieldTable<State>::count;
+                return;
+            case SIMDRIVER_MEMORY:
+                fields = FieldTable<Memory>::fields;
+                count = FieldTable<Memory>::count;
+                return;
+            case SIMDRIVER_PARAMETERS:
+                fields = FieldTable<Parameters>::fields;
+                count = FieldTable<Parameters>::count;
+                return;
+            case SIMDRIVER_SUBCONSCIOUS:
+                fields = FieldTable<Subconscious>::fields;
+                count = FieldTable<Subconscious>::count;
+                return;
+        }
+
+        throw std::invalid_argument("unknown struct.");
+
+    }
+
+}
+
+
+uint32_t simdriver_abi_version(void) {
+
+    return SIMDRIVER_ABI_VERSION;
+
+}
+
+
+uint64_t simdriver_layout_hash(void) {
+
+    uint64_t hash = reflection::layoutHash(nullptr, 0);
+    for (auto type : {SIMDRIVER_INPUT, SIMDRIVER_STATE, SIMDRIVER_MEMORY, SIMDRIVER_PARAMETERS}) {
+
+        const reflection::Field *fields;
+        unsigned int count;
+
+        table(type, fields, count);
+        hash = reflection::layoutHash(fields, count, hash);
+
+    }
+
+    return hash;
+
+}
+
+
+size_t simdriver_sizeof(simdriver_struct type) {
+
+    switch (type) {
+        case SIMDRIVER_INPUT:
+            return sizeof(Input);
+        case SIMDRIVER_STATE:
+            return sizeof(State);
+        case SIMDRIVER_MEMORY:
+            return sizeof(Memory);
+        case SIMDRIVER_PARAMETERS:
+            return sizeof(Parameters);
+        case SIMDRIVER_SUBCONSCIOUS:
+            return sizeof(Subconscious);
+    }
+
+    return 0;
+
+}
+
+
+int simdriver_field(simdriver_struct type, const char *path, size_t *offset, size_t *size,
+                    simdriver_field_type *field) {
+
+    return guard([&]() {
+
+        if (path == nullptr)
+            throw std::invalid_argument("path must not be null.");
+
+        const reflection::Field *fields;
+        unsigned int count;
+        table(type, fields, count);
+
+        auto res = reflection::resolve(fields, count, path);
+
+        if (offset != nullptr)
+            *offset = res.offset;
+
+        if (size != nullptr)
+            *size = res.size;
+
+        if (field != nullptr)
+            *field = (simdriver_field_type) res.field->type;
+
+    });
+
+}
+
+
+const char *simdriver_last_error(void) {
+
+    return lastError.c_str();
+
+}
+
+
+simdriver_pool *simdriver_create(uint32_t n) {
+
+    simdriver_pool *pool = nullptr;
+
+    guard([&]() {
+        std::unique_ptr<simdriver_pool> p(new simdriver_pool);
+        p->agents.resize(n);
+        pool = p.release();
+    });
+
+    return pool;
+
+}
+
+
+void simdriver_destroy(simdriver_pool *pool) {
+
+    delete pool;
+
+}
+
+
+uint32_t simdriver_size(const simdriver_pool *pool) {
+
+    return pool == nullptr ? 0 : (uint32_t) pool->agents.size();
+
+}
+
+
+int simdriver_set_parameters(simdriver_pool *pool, const void *parameters, size_t stride, uint32_t first,
+                             uint32_t count) {
+
+    return guard([&]() {
+
+        check(pool, parameters, first, count);
+
+        stride = stride == 0 ? sizeof(Parameters) : stride;
+        auto data = static_cast<const char *>(parameters);
+
+        for (uint32_t k = 0; k < count; ++k)
+            std::memcpy(pool->agents[first + k].getParameters(), data + k * stride, sizeof(Parameters));
+
+    });
+
+}
+
+
+int simdriver_set_inputs(simdriver_pool *pool, const void *inputs, size_t stride, uint32_t first, uint32_t count) {
+
+    return guard([&]() {
+
+        check(pool, inputs, first, count);
+
+        stride = stride == 0 ? sizeof(Input) : stride;
+        auto data = static_cast<const char *>(inputs);
+
+        for (uint32_t k = 0; k < count; ++k)
+            std::memcpy(pool->agents[first + k].getInput(), data + k * stride, sizeof(Input));
+
+    });
+
+}
+
+
+int simdriver_bind(simdriver_pool *pool, void *inputs, size_t inputStride, void *states, size_t stateStride,
+                   uint32_t first, uint32_t count) {
+
+    return guard([&]() {
+
+        check(pool, pool, first, count);
+
+        inputStride = inputStride == 0 ? sizeof(Input) : inputStride;
+        stateStride = stateStride == 0 ? sizeof(State) : stateStride;
+
+        auto in = static_cast<char *>(inputs);
+        auto st = static_cast<char *>(states);
+
+        for (uint32_t k = 0; k < count; ++k) {
+            pool->agents[first + k].bind(in == nullptr ? nullptr : reinterpret_cast<Input *>(in + k * inputStride),
+                                         st == nullptr ? nullptr : reinterpret_cast<State *>(st + k * stateStride));
+        }
+
+    });
+
+}
+
+
+int simdriver_init(simdriver_pool *pool) {
+
+    return guard([&]() {
+
+        check(pool, pool, 0, 0);
+
+        for (auto &agent : pool->agents)
+            agent.init();
+
+    });
+
+}
+
+
+int simdriver_step(simdriver_pool *pool, double time, uint32_t threads) {
+
+    return guard([&]() {
+
+        check(pool, pool, 0, 0);
+
+        auto n = (uint32_t) pool->agents.size();
+
+        // get number of threads
+        if (threads == 0)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+
+        threads = std::max(1u, std::min(threads, n));
+
+        // step in the calling thread only
+        if (threads == 1) {
+            for (auto &agent : pool->agents)
+                agent.step(time);
+            return;
+        }
+
+        // step contiguous ranges of agents with the persistent workers of the pool
+        pool->workers.step(pool->agents, time, threads);
+
+    });
+
+}
+
+
+int simdriver_get_outputs(const simdriver_pool *pool, void *outputs, size_t stride, uint32_t first, uint32_t count) {
+
+    return guard([&]() {
+
+        check(pool, outputs, first, count);
+
+        stride = stride == 0 ? sizeof(Subconscious) : stride;
+        auto data = static_cast<char *>(outputs);
+
+        for (uint32_t k = 0; k < count; ++k)
+            std::memcpy(data + k * stride, &pool->agents[first + k].getState()->subconscious, sizeof(Subconscious));
+
+    });
+
+}
+
+
+int simdriver_get_states(const simdriver_pool *pool, void *states, size_t stride, uint32_t first, uint32_t count) {
+
+    return guard([&]() {
+
+        check(pool, states, first, count);
+
+        stride = stride == 0 ? sizeof(State) : stride;
+        auto data = static_cast<char *>(states);
+
+        for (uint32_t k = 0; k < count; ++k)
+            std::memcpy(data + k * stride, pool->agents[first + k].getState(), sizeof(State));
+
+    });
+
+}
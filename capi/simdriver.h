@@ -0,0 +1,275 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// simdriver.h
+//
+// C interface of the agent model to be used by foreign simulators (e.g. C or Python via ctypes).
+//
+// A pool holds N agents, which are set, stepped and read in batches. The buffers handed in and out are contiguous
+// arrays of the C++ interface structs (agent_model::Input, State, Parameters and Subconscious) with a stride in bytes
+// between the elements (0: the size of the struct).
+//
+// Layout contract: the structs are the plain structs of src/Interface.h without pointers. Their members are laid out
+// in declaration order by the C rules of the platform: double (8 bytes), int, unsigned int and enums (4 bytes) and
+// bool (1 byte), each aligned to its size, so the structs are aligned to 8 bytes. The arrays have the fixed lengths
+// SIMDRIVER_NOT, SIMDRIVER_NOL, SIMDRIVER_NOS, SIMDRIVER_NOH and SIMDRIVER_NOA. The output struct is repeated in this
+// header (simdriver_subconscious). The other structs are not repeated: callers shall query their size
+// (simdriver_sizeof) and the offsets of their members by path (simdriver_field), e.g. "targets[3].v".
+// SIMDRIVER_ABI_VERSION is increased with every incompatible change of the functions, the array lengths or the output
+// struct, and simdriver_layout_hash changes with every change of a member. A caller shall compare the ABI version of
+// the library with the one it was built with, and the layout hash with the one its offsets were generated for. The
+// soname of the shared library is derived from SIMDRIVER_ABI_VERSION (libsimdriver.so.<version>).
+//
+// All functions return SIMDRIVER_OK (0) on success and a negative error code otherwise. The message of the last error
+// of the calling thread is returned by simdriver_last_error.
+
+
+#ifndef SIMDRIVER_C_H
+#define SIMDRIVER_C_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#define SIMDRIVER_API __declspec(dllexport)
+#else
+#define SIMDRIVER_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** The version of the C interface. Increased with every incompatible change of the functions or the struct layouts. */
+#define SIMDRIVER_ABI_VERSION 2
+
+
+/** The lengths of the arrays of the exchanged structs */
+#define SIMDRIVER_NOT 32             /**< targets (Input::targets) */
+#define SIMDRIVER_NOL 32             /**< lanes (Input::lanes) */
+#define SIMDRIVER_NOS 32             /**< signals (Input::signals) */
+#define SIMDRIVER_NOH 32             /**< horizon points (Input::horizon) */
+#define SIMDRIVER_NOA 32             /**< auxiliary states (State::aux) */
+
+
+/** Error codes */
+#define SIMDRIVER_OK 0
+#define SIMDRIVER_ERROR_ARGUMENT (-1)
+#define SIMDRIVER_ERROR_RANGE (-2)
+#define SIMDRIVER_ERROR_INTERNAL (-3)
+
+
+/** The structs to be exchanged */
+typedef enum {
+    SIMDRIVER_INPUT = 0,         /**< agent_model::Input */
+    SIMDRIVER_STATE = 1,         /**< agent_model::State */
+    SIMDRIVER_MEMORY = 2,        /**< agent_model::Memory */
+    SIMDRIVER_PARAMETERS = 3,    /**< agent_model::Parameters */
+    SIMDRIVER_SUBCONSCIOUS = 4   /**< agent_model::Subconscious */
+} simdriver_struct;
+
+
+/** The types of plain members */
+typedef enum {
+    SIMDRIVER_FIELD_STRUCT = 0,  /**< a struct (or an array of structs) */
+    SIMDRIVER_FIELD_DOUBLE = 1,  /**< double */
+    SIMDRIVER_FIELD_INT = 2,     /**< int (32 bit) */
+    SIMDRIVER_FIELD_UINT = 3,    /**< unsigned int (32 bit) */
+    SIMDRIVER_FIELD_BOOL = 4,    /**< bool (8 bit) */
+    SIMDRIVER_FIELD_ENUM = 5     /**< enum (int) */
+} simdriver_field_type;
+
+
+/** The output of an agent (layout of agent_model::Subconscious) */
+typedef struct {
+    double a;                    /**< desired acceleration (in m/s^2) */
+    double dPsi;                 /**< desired yaw rate (in rad/s) */
+    double kappa;                /**< desired curvature (in 1/m) */
+    double pedal;                /**< desired pedal value */
+    double steering;             /**< desired steering angle */
+} simdriver_subconscious;
+
+
+/** A pool of agents */
+typedef struct simdriver_pool simdriver_pool;
+
+
+/**
+ * Returns the version of the C interface of the library (to be compared with SIMDRIVER_ABI_VERSION)
+ * @return The version
+ */
+SIMDRIVER_API uint32_t simdriver_abi_version(void);
+
+
+/**
+ * Returns a hash of the layout of all exchanged structs. The hash changes with every change of a member.
+ * @return The hash
+ */
+SIMDRIVER_API uint64_t simdriver_layout_hash(void);
+
+
+/**
+ * Returns the size of an exchanged struct
+ * @param type The struct
+ * @return The size (in bytes), 0 for an unknown struct
+ */
+SIMDRIVER_API size_t simdriver_sizeof(simdriver_struct type);
+
+
+/**
+ * Resolves the member of an exchanged struct by path (e.g. "targets[3].v" of SIMDRIVER_INPUT)
+ * @param type The struct
+ * @param path The path of the member
+ * @param offset The byte offset of the member (output, may be NULL)
+ * @param size The size of the member in bytes (output, may be NULL)
+ * @param field The type of the member (output, may be NULL)
+ * @return Error code
+ */
+SIMDRIVER_API int simdriver_field(simdriver_struct type, const char *path, size_t *offset, size_t *size,
+                                  simdriver_field_type *field);
+
+
+/**
+ * Returns the message of the last error of the calling thread, valid until the next call of the thread
+ * @return The message (empty if the last call succeeded)
+ */
+SIMDRIVER_API const char *simdriver_last_error(void);
+
+
+/**
+ * Creates a pool of agents
+ * @param n The number of agents
+ * @return The pool, NULL on error
+ */
+SIMDRIVER_API simdriver_pool *simdriver_create(uint32_t n);
+
+
+/**
+ * Destroys the pool
+ * @param pool The pool
+ */
+SIMDRIVER_API void simdriver_destroy(simdriver_pool *pool);
+
+
+/**
+ * Returns the number of agents of the pool
+ * @param pool The pool
+ * @return The number of agents
+ */
+SIMDRIVER_API uint32_t simdriver_size(const simdriver_pool *pool);
+
+
+/**
+ * Copies the parameters of the agents first, ..., first + count - 1 from the array
+ * @param pool The pool
+ * @param parameters Array of agent_model::Parameters
+ * @param stride Bytes between the elements (0: sizeof(Parameters))
+ * @param first Index of the first agent
+ * @param count Number of agents
+ * @return Error code
+ */
+SIMDRIVER_API int simdriver_set_parameters(simdriver_pool *pool, const void *parameters, size_t stride,
+                                           uint32_t first, uint32_t count);
+
+
+/**
+ * Copies the inputs of the agents first, ..., first + count - 1 from the array
+ * @param pool The pool
+ * @param inputs Array of agent_model::Input
+ * @param stride Bytes between the elements (0: sizeof(Input))
+ * @param first Index of the first agent
+ * @param count Number of agents
+ * @return Error code
+ */
+SIMDRIVER_API int simdriver_set_inputs(simdriver_pool *pool, const void *inputs, size_t stride, uint32_t first,
+                                       uint32_t count);
+
+
+/**
+ * Binds the inputs and states of the agents first, ..., first + count - 1 to the arrays, which are then read and
+ * written in place during the step. The arrays must be aligned to 8 bytes and outlive the binding. NULL binds the
+ * agents' own buffers again.
+ * @param pool The pool
+ * @param inputs Array of agent_model::Input (may be NULL)
+ * @param inputStride Bytes between the inputs (0: sizeof(Input))
+ * @param states Array of agent_model::State (may be NULL)
+ * @param stateStride Bytes between the states (0: sizeof(State))
+ * @param first Index of the first agent
+ * @param count Number of agents
+ * @return Error code
+ */
+SIMDRIVER_API int simdriver_bind(simdriver_pool *pool, void *inputs, size_t inputStride, void *states,
+                                 size_t stateStride, uint32_t first, uint32_t count);
+
+
+/**
+ * Initializes all agents of the pool (after the parameters and inputs are set)
+ * @param pool The pool
+ * @return Error code
+ */
+SIMDRIVER_API int simdriver_init(simdriver_pool *pool);
+
+
+/**
+ * Steps all agents of the pool. The worker threads are started on the first parallel step and kept by the pool until
+ * it is destroyed or the number of threads changes. A pool must not be stepped from several threads at the same time.
+ * @param pool The pool
+ * @param time The simulation time
+ * @param threads The number of threads (0: number of hardware threads, 1: calling thread only)
+ * @return Error code
+ */
+SIMDRIVER_API int simdriver_step(simdriver_pool *pool, double time, uint32_t threads);
+
+
+/**
+ * Copies the subconscious states (the outputs) of the agents first, ..., first + count - 1 into the array
+ * @param pool The pool
+ * @param outputs Array of simdriver_subconscious (agent_model::Subconscious)
+ * @param stride Bytes between the elements (0: sizeof(Subconscious))
+ * @param first Index of the first agent
+ * @param count Number of agents
+ * @return Error code
+ */
+SIMDRIVER_API int simdriver_get_outputs(const simdriver_pool *pool, void *outputs, size_t stride, uint32_t first,
+                                        uint32_t count);
+
+
+/**
+ * Copies the states of the agents first, ..., first + count - 1 into the array
+ * @param pool The pool
+ * @param states Array of agent_model::State
+ * @param stride Bytes between the elements (0: sizeof(State))
+ * @param first Index of the first agent
+ * @param count Number of agents
+ * @return Error code
+ */
+SIMDRIVER_API int simdriver_get_states(const simdriver_pool *pool, void *states, size_t stride, uint32_t first,
+                                       uint32_t count);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIMDRIVER_C_H
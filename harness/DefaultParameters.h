@@ -0,0 +1,73 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// DefaultParameters.h
+
+
+#ifndef SIMDRIVER_DEFAULT_PARAMETERS_H
+#define SIMDRIVER_DEFAULT_PARAMETERS_H
+
+#include "Interface.h"
+
+namespace agent_model {
+
+
+    /**
+     * Sets a default parameter set of a driver used by the harnesses
+     * @param p Parameters
+     * @tparam T The scalar type of the parameters
+     */
+    template<typename T>
+    void defaultParameters(BasicParameters<T> &p) {
+
+        p.vehicle.size = {2.0, 5.0};
+        p.vehicle.pos = {0.0, 0.0};
+
+        p.laneChange = {2.0, 0.1, 0.5, 4.0};
+
+        p.stop.dsGap = 2.0;
+        p.stop.TMax = 8.0;
+        p.stop.dsMax = 100.0;
+        p.stop.T = 2.0;
+        p.stop.tSign = 2.0;
+        p.stop.vStopped = 0.2;
+        p.stop.pedalDuringStanding = -0.3;
+
+        p.velocity = {10.0, 4.0, 3.0, 2.0, -2.0, 1.0, 2.0, 30.0};
+        p.follow = {1.8, 2.0, 10.0};
+
+        p.steering.thw[0] = 1.0;
+        p.steering.thw[1] = 2.0;
+        p.steering.dsMin[0] = 5.0;
+        p.steering.dsMin[1] = 10.0;
+        p.steering.P[0] = 0.2;
+        p.steering.P[1] = 0.1;
+        p.steering.D[0] = 0.1;
+        p.steering.D[1] = 0.05;
+
+    }
+
+
+}
+
+#endif // SIMDRIVER_DEFAULT_PARAMETERS_H
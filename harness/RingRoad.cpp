@@ -0,0 +1,307 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// RingRoad.cpp
+
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "RingRoad.h"
+
+namespace agent_model {
+
+
+    static const double PI = 3.14159265358979323846;
+    static const double ROUTE = 10000.0;        //!< The route length of the desired lane (in *m*)
+    static const double ROUTE_PENALTY = 100.0;  //!< The route reduction per lane to the desired lane (in *m*)
+    static const double HORIZON_STEP = 5.0;     //!< The distance between the horizon points (in *m*)
+
+
+    void RingRoad::init(const Parameters &parameters, const agent_model::Parameters &driver, unsigned int n,
+                        const Population *population) {
+
+        if (parameters.lanes == 0 || parameters.lanes > NOL)
+            throw std::invalid_argument("number of lanes must be between one and the maximum number of lanes.");
+
+        if (parameters.length <= 0.0 || parameters.stepSize <= 0.0)
+            throw std::invalid_argument("length and step size must be positive.");
+
+        _param = parameters;
+        _agents.assign(n, AgentModel(Pipeline().mobil(parameters.mobil)));
+        _vehicles.resize(n);
+        _states.assign(n, Target{});
+        _index = LaneIndex(_param.lanes, _param.length);
+
+        _time = 0.0;
+        _steps = 0;
+
+        // place vehicles evenly on the lanes
+        unsigned int perLane = (n + _param.lanes - 1) / _param.lanes;
+        for (unsigned int k = 0; k < n; ++k) {
+
+            auto &v = _vehicles[k];
+            v.id = k + 1;
+            v.lane = k % _param.lanes;
+            v.desiredLane = v.lane;
+            v.position = (k / _param.lanes) * _param.length / std::max(1u, perLane);
+
+            // set parameters
+            auto &agent = _agents[k];
+            if (population != nullptr)
+                population->generate(driver, v.id, *agent.getParameters());
+            else
+                *agent.getParameters() = driver;
+
+            // set initial state
+            auto &vehicle = agent.getInput()->vehicle;
+            vehicle.v = _param.velocity;
+            vehicle.dsIntersection = INFINITY;
+
+        }
+
+        // initialize the drivers with the first input
+        update();
+        for (unsigned int k = 0; k < n; ++k) {
+            input(k);
+            _agents[k].init();
+        }
+
+        resetStatistics();
+
+    }
+
+
+    void RingRoad::step() {
+
+        auto n = (unsigned int) _agents.size();
+        auto dt = _param.stepSize;
+
+        // pick new desired lanes (only without discretionary lane changes)
+        for (unsigned int k = 0; k < n && !_param.mobil; ++k) {
+
+            auto &v = _vehicles[k];
+            if (Population::uniform(_param.seed, v.id, 2 * _steps) < _param.laneChangeRate * dt) {
+                auto u = Population::uniform(_param.seed, v.id, 2 * _steps + 1);
+                v.desiredLane = std::min(_param.lanes - 1, (unsigned int) (u * _param.lanes));
+            }
+
+        }
+
+        // assemble inputs (all inputs are based on the same positions)
+        update();
+        for (unsigned int k = 0; k < n; ++k)
+            input(k);
+
+        // step drivers
+        for (auto &agent : _agents)
+            agent.step(_time);
+
+        // integrate vehicles
+        double speed = 0.0;
+        for (unsigned int k = 0; k < n; ++k) {
+
+            auto &v = _vehicles[k];
+            auto &agent = _agents[k];
+            auto &vehicle = agent.getInput()->vehicle;
+
+            double s0 = vehicle.s;
+            _vehicleModel.step(agent, dt);
+
+            // move on the ring
+            v.position += vehicle.s - s0;
+            if (v.position >= _param.length) {
+                v.position -= _param.length;
+                ++_crossings;
+            }
+
+            // the driver has finished a lane change, the reference lane is switched
+            auto sw = agent.getMemory()->laneChange.switchLane;
+            if (sw != 0) {
+
+                int lane = (int) v.lane + sw;
+                if (lane >= 0 && lane < (int) _param.lanes) {
+                    v.lane = (unsigned int) lane;
+                    vehicle.d -= sw * _param.laneWidth;
+                    ++_laneChanges;
+                }
+
+            }
+
+            speed += vehicle.v;
+
+        }
+
+        _speedSum += n == 0 ? 0.0 : speed / n;
+        _time += dt;
+        ++_steps;
+
+    }
+
+
+    void RingRoad::resetStatistics() {
+
+        _crossings = 0;
+        _laneChanges = 0;
+        _speedSum = 0.0;
+        _resetTime = _time;
+
+    }
+
+
+    RingRoad::Statistics RingRoad::statistics() const {
+
+        Statistics st{};
+        st.time = _time - _resetTime;
+        st.density = _vehicles.size() / (_param.length / 1000.0);
+        st.flow = st.time <= 0.0 ? 0.0 : _crossings / st.time * 3600.0;
+        st.speed = st.time <= 0.0 ? 0.0 : _speedSum * _param.stepSize / st.time * 3.6;
+        st.laneChanges = _laneChanges;
+
+        return st;
+
+    }
+
+
+    void RingRoad::input(unsigned int k) {
+
+        auto &ego = _vehicles[k];
+        auto &in = *_agents[k].getInput();
+
+        in.vehicle.maneuver = STRAIGHT;
+        horizon(in, ego.lane);
+
+        // lanes (id: lane relative to the ego lane, positive to the left)
+        in.numLanes = _param.lanes;
+        for (unsigned int i = 0; i < _param.lanes; ++i) {
+
+            auto &lane = in.lanes[i];
+            auto diff = _param.mobil ? 0 : std::abs((int) i - (int) ego.desiredLane);
+
+            lane.id = (int) i - (int) ego.lane;
+            lane.width = _param.laneWidth;
+            lane.route = ROUTE - diff * ROUTE_PENALTY;
+            lane.closed = INFINITY;
+            lane.dir = DD_FORWARDS;
+            lane.access = ACC_ACCESSIBLE;
+            lane.lane_change = diff == 0 ? 0 : 1;
+
+        }
+
+        // no signals
+        for (auto &signal : in.signals)
+            signal = Signal{};
+
+        // nearest vehicles on the occupied lane and the lanes up to LaneIndex::RANGE beside (relative to the reference lane)
+        auto m = _index.fill(k, _states.data(), in.targets);
+        in.numTargets = m;
+        in.numSignals = 0;
+        in.countsValid = true;
+        auto shift = occupiedLane(k) - (int) ego.lane;
+        for (unsigned int i = 0; i < m; ++i) {
+            in.targets[i].lane += shift;
+            in.targets[i].psi -= in.vehicle.psi;
+        }
+
+    }
+
+
+    void RingRoad::update() {
+
+        // the index and the target descriptions are based on the positions at the beginning of the step
+        for (unsigned int k = 0; k < _vehicles.size(); ++k) {
+
+            auto &v = _vehicles[k];
+            auto &state = _agents[k].getInput()->vehicle;
+
+            _index.update(k, (unsigned int) occupiedLane(k), v.position);
+
+            auto &t = _states[k];
+            t.id = v.id;
+            t.v = state.v;
+            t.a = state.a;
+            t.d = state.d;
+            t.psi = state.psi;
+            t.size = _agents[k].getParameters()->vehicle.size;
+            t.dsIntersection = INFINITY;
+            t.priority = TARGET_PRIORITY_NOT_SET;
+            t.position = TARGET_NOT_RELEVANT;
+
+        }
+
+        _index.sort();
+
+    }
+
+
+    void RingRoad::horizon(Input &in, unsigned int lane) const {
+
+        auto &h = in.horizon;
+        double d = in.vehicle.d;
+        double psi = in.vehicle.psi;
+        double sn = std::sin(psi), cn = std::cos(psi);
+
+        // curvature of the ring and offsets to the neighbouring lanes
+        double right = lane > 0 ? _param.laneWidth : 0.0;
+        double left = lane + 1 < _param.lanes ? _param.laneWidth : 0.0;
+        double kappa = _param.curved ? 2.0 * PI / _param.length : 0.0;
+
+        for (unsigned int i = 0; i < NOH; ++i) {
+
+            double ds = i * HORIZON_STEP - HORIZON_STEP;
+
+            // point of the lane center in the road frame at the vehicle's position
+            double x = _param.curved ? std::sin(ds * kappa) / kappa : ds;
+            double y = (_param.curved ? (1.0 - std::cos(ds * kappa)) / kappa : 0.0) - d;
+
+            // relative to the vehicle
+            h.ds[i] = ds;
+            h.x[i] = cn * x + sn * y;
+            h.y[i] = -sn * x + cn * y;
+            h.psi[i] = ds * kappa - psi;
+            h.kappa[i] = kappa;
+            h.egoLaneWidth[i] = _param.laneWidth;
+            h.rightLaneOffset[i] = right;
+            h.leftLaneOffset[i] = left;
+
+        }
+
+        h.destinationPoint = -1.0;
+        in.numHorizon = NOH;
+
+    }
+
+
+    int RingRoad::occupiedLane(unsigned int k) const {
+
+        // a vehicle changing lanes occupies the target lane once it has crossed the lane marking
+        auto d = _agents[k].getInput()->vehicle.d;
+        auto lane = (int) _vehicles[k].lane + (int) std::lround(d / _param.laneWidth);
+
+        return std::max(0, std::min((int) _param.lanes - 1, lane));
+
+    }
+
+
+}
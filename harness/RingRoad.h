@@ -0,0 +1,193 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// RingRoad.h
+
+
+#ifndef SIMDRIVER_RING_ROAD_H
+#define SIMDRIVER_RING_ROAD_H
+
+#include <cstdint>
+#include <vector>
+
+#include "AgentModel.h"
+#include "LaneIndex.h"
+#include "Population.h"
+#include "VehicleModel.h"
+
+namespace agent_model {
+
+
+    /**
+     * @brief A multi-lane ring road with N drivers for stress tests and fundamental-diagram studies
+     * In each step, the inputs of all drivers are assembled from the simulated vehicles (horizon of the ego lane,
+     * lanes and the nearest NOT vehicles as targets), all drivers are stepped and the vehicles are integrated with the
+     * kinematic vehicle model. The vehicles pick a random desired lane from time to time, which is passed to the
+     * drivers as route-based lane change, so the lane change decisions are exercised as well.
+     */
+    class RingRoad {
+
+    public:
+
+        /**
+         * @brief The parameters of the ring road
+         */
+        struct Parameters {
+            double length = 2000.0;             //!< The length of the ring (in *m*)
+            unsigned int lanes = 2;             //!< The number of lanes
+            double laneWidth = 3.5;             //!< The width of the lanes (in *m*)
+            bool curved = true;                 //!< Flag whether the ring is curved (false: periodic straight road)
+            double stepSize = 0.1;              //!< The step size (in *s*)
+            double velocity = 10.0;             //!< The initial velocity of the vehicles (in *m/s*)
+            double laneChangeRate = 0.02;       //!< The rate at which a vehicle picks a new desired lane (in *1/s*)
+            bool mobil = false;                 //!< Flag whether the drivers decide discretionary lane changes (MOBIL) instead of picking desired lanes
+            uint64_t seed = 1;                  //!< The seed of the random numbers
+        };
+
+
+        /**
+         * @brief The state of a simulated vehicle
+         */
+        struct Vehicle {
+            unsigned int id;                    //!< The id of the vehicle (> 0)
+            unsigned int lane;                  //!< The lane of the vehicle (0: rightmost lane)
+            unsigned int desiredLane;           //!< The lane the vehicle shall change to
+            double position;                    //!< The position on the ring [0, length) (in *m*)
+        };
+
+
+        /**
+         * @brief Statistics of the simulation since the last reset
+         */
+        struct Statistics {
+            double time;                        //!< The measured time (in *s*)
+            double density;                     //!< The density (in *veh/km*, all lanes)
+            double flow;                        //!< The flow measured at position 0 (in *veh/h*, all lanes)
+            double speed;                       //!< The space-mean speed (in *km/h*)
+            unsigned long laneChanges;          //!< The number of completed lane changes
+        };
+
+
+    protected:
+
+        Parameters _param{};                                 //!< The parameters
+        VehicleModel _vehicleModel{};                        //!< The vehicle model
+        std::vector<AgentModel> _agents{};                   //!< The drivers
+        std::vector<Vehicle> _vehicles{};                    //!< The vehicles
+        std::vector<Target> _states{};                       //!< The target descriptions of the vehicles
+        LaneIndex _index{};                                  //!< The spatial index of the vehicles
+
+        double _time = 0.0;                 //!< The simulation time
+        unsigned long _steps = 0;           //!< The number of steps
+        unsigned long _crossings = 0;       //!< The number of crossings at position 0 since the last reset
+        unsigned long _laneChanges = 0;     //!< The number of completed lane changes since the last reset
+        double _speedSum = 0.0;             //!< The sum of the mean speeds of all steps since the last reset
+        double _resetTime = 0.0;            //!< The time of the last reset
+
+
+    public:
+
+        /**
+         * Places the vehicles evenly on the lanes and initializes the drivers
+         * @param parameters The parameters of the ring road
+         * @param driver The base parameters of the drivers
+         * @param n The number of vehicles
+         * @param population The population to vary the driver parameters (optional)
+         */
+        void init(const Parameters &parameters, const agent_model::Parameters &driver, unsigned int n,
+                  const Population *population = nullptr);
+
+
+        /**
+         * Runs one step of all drivers and vehicles
+         */
+        void step();
+
+
+        /**
+         * Resets the statistics (e.g. after a warm-up phase)
+         */
+        void resetStatistics();
+
+
+        /**
+         * Returns the statistics since the last reset
+         * @return The statistics
+         */
+        Statistics statistics() const;
+
+
+        /**
+         * Returns the vehicles
+         * @return The vehicles
+         */
+        const std::vector<Vehicle> &vehicles() const {
+            return _vehicles;
+        }
+
+
+        /**
+         * Returns the drivers
+         * @return The drivers
+         */
+        std::vector<AgentModel> &agents() {
+            return _agents;
+        }
+
+
+    protected:
+
+        /**
+         * Assembles the input of the driver of vehicle k
+         * @param k Index of the vehicle
+         */
+        void input(unsigned int k);
+
+
+        /**
+         * Writes the horizon of the ego lane relative to the vehicle
+         * @param in The input to be written
+         * @param lane The lane of the vehicle
+         */
+        void horizon(Input &in, unsigned int lane) const;
+
+
+        /**
+         * Returns the lane the vehicle k is located in, considering its lateral offset
+         * @param k Index of the vehicle
+         * @return The lane (0: rightmost lane)
+         */
+        int occupiedLane(unsigned int k) const;
+
+
+        /**
+         * Updates the spatial index and the target descriptions of all vehicles
+         */
+        void update();
+
+    };
+
+
+}
+
+#endif // SIMDRIVER_RING_ROAD_H
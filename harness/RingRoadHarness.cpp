@@ -0,0 +1,90 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// RingRoadHarness.cpp
+//
+// Runs N drivers on a multi-lane ring road and reports the throughput of the model and the traffic state.
+//
+// Usage: ring_road [vehicles=200] [lanes=2] [length=2000] [steps=3000] [curved=1] [seed=1] [mobil=0]
+
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+#include "RingRoad.h"
+#include "DefaultParameters.h"
+
+using namespace agent_model;
+
+
+int main(int argc, char **argv) {
+
+    unsigned int n = argc > 1 ? (unsigned int) std::atoi(argv[1]) : 200;
+    unsigned int steps = argc > 4 ? (unsigned int) std::atoi(argv[4]) : 3000;
+
+    RingRoad::Parameters road;
+    road.lanes = argc > 2 ? (unsigned int) std::atoi(argv[2]) : 2;
+    road.length = argc > 3 ? std::atof(argv[3]) : 2000.0;
+    road.curved = argc > 5 ? std::atoi(argv[5]) != 0 : true;
+    road.seed = argc > 6 ? (uint64_t) std::atoll(argv[6]) : 1;
+    road.mobil = argc > 7 && std::atoi(argv[7]) != 0;
+
+    // heterogeneous drivers
+    Parameters base{};
+    defaultParameters(base);
+
+    Population population(road.seed);
+    population.addVariable(offsetof(Parameters, velocity.vComfort), {DIST_NORMAL, 30.0, 3.0, 20.0, 40.0});
+    population.addVariable(offsetof(Parameters, follow.timeHeadway), {DIST_NORMAL, 1.8, 0.3, 1.0, 3.0});
+
+    RingRoad ring;
+    ring.init(road, base, n, &population);
+
+    // warm-up (the first tenth of the steps) is not part of the statistics
+    unsigned int warmUp = steps / 10;
+    for (unsigned int i = 0; i < warmUp; ++i)
+        ring.step();
+
+    ring.resetStatistics();
+
+    auto t0 = std::chrono::steady_clock::now();
+
+    for (unsigned int i = warmUp; i < steps; ++i)
+        ring.step();
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    double sec = std::chrono::duration<double>(t1 - t0).count();
+    auto st = ring.statistics();
+
+    std::printf("vehicles: %u, lanes: %u, length: %.0f m, steps: %u, agent-steps/s: %.0f\n",
+                n, road.lanes, road.length, steps - warmUp, (double) n * (steps - warmUp) / sec);
+    std::printf("density: %.1f veh/km (%.1f veh/km/lane), flow: %.0f veh/h (%.0f veh/h/lane), speed: %.1f km/h, "
+                "lane changes: %lu\n", st.density, st.density / road.lanes, st.flow, st.flow / road.lanes,
+                st.speed, st.laneChanges);
+
+    return 0;
+
+}
@@ -0,0 +1,195 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// SharedMemoryHarness.cpp
+//
+// A local stand-in for the simulator: a platoon of vehicles on a straight road is simulated in this process, the
+// drivers are stepped in a forked driver process through the shared-memory transport.
+//
+// Usage: shm_harness [agents=64] [steps=2000]
+
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "SharedMemory.h"
+#include "DefaultParameters.h"
+
+using namespace agent_model;
+
+
+/**
+ * Writes the input of a vehicle on a straight road
+ * @param in Input
+ * @param v Velocity of the vehicle
+ * @param ds Distance to the leading vehicle (infinite if none)
+ * @param vLead Velocity of the leading vehicle
+ */
+static void input(Input &in, double v, double ds, double vLead) {
+
+    in = Input{};
+
+    in.vehicle.v = v;
+    in.vehicle.dsIntersection = INFINITY;
+
+    // straight horizon
+    for (unsigned int i = 0; i < NOH; ++i) {
+        in.horizon.ds[i] = i * 10.0 - 5.0;
+        in.horizon.x[i] = in.horizon.ds[i];
+        in.horizon.egoLaneWidth[i] = 3.5;
+        in.horizon.rightLaneOffset[i] = 3.5;
+        in.horizon.leftLaneOffset[i] = 3.5;
+    }
+
+    in.horizon.destinationPoint = -1.0;
+
+    // ego lane only
+    in.lanes[0] = Lane{0, 3.5, INFINITY, INFINITY, DD_FORWARDS, ACC_ACCESSIBLE, 0};
+    in.numLanes = 1;
+    in.numHorizon = NOH;
+    in.countsValid = true;
+
+    // leading vehicle
+    for (auto &t : in.targets) {
+        t.ds = INFINITY;
+        t.dsIntersection = INFINITY;
+    }
+
+    if (!std::isinf(ds)) {
+        in.targets[0].id = 1;
+        in.targets[0].ds = ds;
+        in.targets[0].v = vLead;
+        in.targets[0].size = {2.0, 5.0};
+        in.numTargets = 1;
+    }
+
+}
+
+
+/**
+ * Runs the driver process
+ * @param name Name of the region
+ * @return Exit code
+ */
+static int driver(const std::string &name) {
+
+    try {
+
+        SharedMemory shm;
+        shm.open(name);
+
+        std::vector<AgentModel> agents(shm.agents());
+        for (auto &a : agents) {
+            defaultParameters(*a.getParameters());
+            input(*a.getInput(), 10.0, INFINITY, 0.0);
+            a.init();
+        }
+
+        shm.serve(agents.data(), (unsigned int) agents.size());
+
+    } catch (std::exception &e) {
+
+        std::fprintf(stderr, "driver: %s\n", e.what());
+        return 1;
+
+    }
+
+    return 0;
+
+}
+
+
+int main(int argc, char **argv) {
+
+    unsigned int n = argc > 1 ? (unsigned int) std::atoi(argv[1]) : 64;
+    unsigned int steps = argc > 2 ? (unsigned int) std::atoi(argv[2]) : 2000;
+    double dt = 0.1;
+
+    auto name = "/simdriver_harness_" + std::to_string(getpid());
+
+    SharedMemory shm;
+    shm.create(name, n);
+
+    auto pid = fork();
+    if (pid < 0) {
+        std::perror("fork");
+        return 1;
+    }
+
+    if (pid == 0)
+        _exit(driver(name));
+
+    // platoon of vehicles, the first one drives freely
+    std::vector<double> s(n), v(n, 10.0);
+    for (unsigned int k = 0; k < n; ++k)
+        s[k] = -30.0 * k;
+
+    auto t0 = std::chrono::steady_clock::now();
+
+    for (unsigned int i = 0; i < steps; ++i) {
+
+        // write inputs in place
+        auto inputs = shm.beginRequest();
+        for (unsigned int k = 0; k < n; ++k) {
+            double ds = k == 0 ? INFINITY : s[k - 1] - s[k];
+            input(inputs[k], v[k], ds, k == 0 ? 0.0 : v[k - 1]);
+        }
+
+        shm.commitRequest(i * dt, n);
+
+        // integrate the vehicles
+        unsigned int count;
+        auto results = shm.waitResponse(count);
+        for (unsigned int k = 0; k < count; ++k) {
+            v[k] = std::max(0.0, v[k] + results[k].a * dt);
+            s[k] += v[k] * dt;
+        }
+
+        shm.releaseResponse();
+
+    }
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    // stop driver process
+    shm.beginRequest();
+    shm.commitRequest(steps * dt, 0, true);
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+
+    double sec = std::chrono::duration<double>(t1 - t0).count();
+    std::printf("agents: %u, steps: %u, round trips/s: %.0f, agent-steps/s: %.0f, mean round trip: %.1f us\n",
+                n, steps, steps / sec, (double) n * steps / sec, 1e6 * sec / steps);
+    std::printf("leader: s=%.1f m v=%.2f m/s, last: s=%.1f m v=%.2f m/s\n", s[0], v[0], s[n - 1], v[n - 1]);
+
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0 ? 0 : 1;
+
+}
@@ -28,7 +28,9 @@
 #define DATA_GENERATOR_REGISTRATION_H
 
 #include <memory>
+#include <type_traits>
 #include "InjectionInterface.h"
+#include "InjectionRegistry.h"
 
 /**
  * @brief Injection class used to wrap a regular value and enable the injection of the value
@@ -37,12 +39,20 @@
 template<typename T>
 class Injection : public InjectionInterface {
 
+    static_assert(std::is_trivially_copyable<T>::value, "injected values must be trivially copyable.");
+
 public:
 
-    T *_ptr; //!< The calculated actual value
-    std::unique_ptr<T> _inj; //!< The injected value
+    T *_ptr = nullptr; //!< The calculated actual value
+
+
+protected:
+
+    std::unique_ptr<T> _pending; //!< The value set before the injection was registered
 
 
+public:
+
     /**
      * Default constructor
      */
@@ -67,14 +77,23 @@ public:
 
 
     /**
-     * Creates the injection
+     * Creates the injection. The value is patched at its offset relative to the base address, i.e. at the same
+     * position of the struct passed to InjectionRegistry::apply(), even if the struct has been moved.
      * @param pointer Pointer to the base value
-     * @param owner Owner of the value
+     * @param key Key of the owner entry
+     * @param base Base address of the struct, which contains the value
+     * @param registry Registry to hold the owner entry
      */
-    void registerValue(T *pointer, const void *owner) {
+    void registerValue(T *pointer, const void *key, const void *base, InjectionRegistry &registry) {
 
         _ptr = pointer;
-        registerInjection(owner);
+        registerInjection(registry, key, base, pointer);
+
+        // inject value set before registration
+        if (_pending) {
+            inject(_pending.get(), sizeof(T));
+            _pending.reset(nullptr);
+        }
 
     }
 
@@ -102,24 +121,13 @@ public:
      * @param value The value to be set
      */
     Injection &operator=(const T &value) {
-        _inj.reset(new T(value));
-        return *this;
-    }
 
+        if (_owner == nullptr)
+            _pending.reset(new T(value));
+        else
+            inject(&value, sizeof(T));
 
-protected:
-
-
-    void apply() override {
-
-        *_ptr = _inj ? *_inj : *_ptr;
-
-    }
-
-
-    void reset() override {
-
-        _inj.reset(nullptr);
+        return *this;
 
     }
 
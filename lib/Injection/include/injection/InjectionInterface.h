@@ -26,63 +26,92 @@
 #ifndef DATA_GENERATOR_REGISTRATION_INTERFACE_H
 #define DATA_GENERATOR_REGISTRATION_INTERFACE_H
 
-#include <string>
-#include <map>
+#include <cstddef>
 #include <vector>
 
+class InjectionRegistry;
+
 /**
- * The InjectionInterface implements a injection for an injection object with a associated owner, handles the
- * index and provides a method to apply all values of a given owner.
+ * The InjectionInterface implements a injection for an injection object with a associated owner. The owner entry
+ * is held by an InjectionRegistry, which provides the methods to apply all values of a given owner.
+ *
+ * Injected values are compiled into a flat patch list of the owner (byte offset, size and value). The values are
+ * stored in an arena of the owner, which keeps its capacity when the patches are reset. Applying the injections of
+ * an owner is a loop of memcpy calls over the patch list, and a step without any injected values costs almost nothing.
+ *
+ * An injection is bound to the address of its value and can therefore not be copied.
  */
 struct InjectionInterface {
 
-public:
+    friend class InjectionRegistry;
 
-    static std::map<const void *, std::vector<InjectionInterface *>> _index; //!< The index of all injection owners
+public:
 
     /**
-     * Runs the apply() method of all elements associated with the given owner
-     * @param owner Owner of the element
+     * @brief A patch to be applied to the owner
      */
-    static void applyAll(const void *owner);
-
+    struct Patch {
+        unsigned long rank;          //!< The rank of the patch (order of application)
+        InjectionInterface *element; //!< The injection which created the patch (nullptr for direct patches)
+        std::ptrdiff_t offset;       //!< The byte offset of the target value relative to the owner
+        size_t size;                 //!< The size of the value (in *bytes*)
+        size_t data;                 //!< The position of the value in the arena
+    };
 
     /**
-     * Runs the reset() method of all elements associated with the given owner
-     * @param owner Owner of the element
+     * @brief The registered injections and the compiled patches of an owner
      */
-    static void resetAll(const void *owner);
+    struct Owner {
+        const void *key = nullptr;                  //!< The key of the owner
+        char *base = nullptr;                       //!< The base address of the owner (if applied without an address)
+        std::vector<InjectionInterface *> elements; //!< All registered injections (in order of registration)
+        std::vector<Patch> patches;                 //!< The patches to be applied
+        std::vector<unsigned char> arena;           //!< The storage of the patch values
+    };
 
 
     /**
-     * Removes the object associated with the given owner
-     * @param owner Owner to be removed
+     * Default constructor
      */
-    static void remove(const void *owner);
+    InjectionInterface() = default;
 
 
-protected:
+    InjectionInterface(const InjectionInterface &) = delete;
+    InjectionInterface &operator=(const InjectionInterface &) = delete;
 
 
     /**
-     * Resets the injection
+     * Destructor, removes the injection from its owner
      */
-    virtual void reset() = 0;
+    ~InjectionInterface();
+
+
+protected:
+
+    Owner *_owner = nullptr;      //!< The owner entry of this injection
+    unsigned long _rank = 0;      //!< The position of this injection in the owner's registration order
+    std::ptrdiff_t _offset = 0;   //!< The byte offset of the value relative to the owner
+    long _patch = -1;             //!< The index of the patch of this injection (-1: no value injected)
 
 
     /**
-     * Applies the actual value to the base value
+     * Registers an object in combination with the owner
+     * @param registry Registry to hold the owner entry
+     * @param key Key of the owner entry
+     * @param base Base address of the owner (the offset of the value is measured from this address)
+     * @param target Address of the value
      */
-    virtual void apply() = 0;
+    void registerInjection(InjectionRegistry &registry, const void *key, const void *base, const void *target);
 
 
     /**
-     * Registers an object in combination with the owner
-     * @param owner Owner of the object
+     * Adds the value to the patch list of the owner or replaces the value, if already injected
+     * @param value Pointer to the value
+     * @param size Size of the value (in *bytes*)
      */
-    void registerInjection(const void *owner);
+    void inject(const void *value, size_t size);
 
 };
 
 
-#endif // DATA_GENERATOR_REGISTRATION_INTERFACE_H
\ No newline at end of file
+#endif // DATA_GENERATOR_REGISTRATION_INTERFACE_H
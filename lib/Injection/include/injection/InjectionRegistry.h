@@ -0,0 +1,143 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// InjectionRegistry.h
+
+#ifndef DATA_GENERATOR_REGISTRY_H
+#define DATA_GENERATOR_REGISTRY_H
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <vector>
+#include "InjectionInterface.h"
+
+/**
+ * The InjectionRegistry holds the owner entries of a set of injections, e.g. of one agent model instance. The
+ * registry is not synchronized: it is meant to be used by one thread at a time, while different registries can be
+ * used from different threads in parallel. The owners are stored in a small flat list, which is scanned linearly.
+ */
+class InjectionRegistry {
+
+    std::vector<std::unique_ptr<InjectionInterface::Owner>> _owners{}; //!< The owner entries
+
+
+public:
+
+    /** The rank of direct patches, which are applied after the registered injections in order of injection */
+    static constexpr unsigned long DIRECT_RANK = std::numeric_limits<unsigned long>::max();
+
+    /**
+     * Default constructor
+     */
+    InjectionRegistry() = default;
+
+
+    /**
+     * Copy constructor, creates an empty registry (the injections are bound to the addresses of the original)
+     */
+    InjectionRegistry(const InjectionRegistry &) : InjectionRegistry() {}
+
+
+    /**
+     * Copy assignment, keeps the own registrations
+     * @return This registry
+     */
+    InjectionRegistry &operator=(const InjectionRegistry &) { return *this; }
+
+
+    /**
+     * Destructor, detaches all registered injections
+     */
+    ~InjectionRegistry();
+
+
+    /**
+     * Returns the entry of the given owner and creates it, if not existing
+     * @param owner Owner
+     * @return The owner entry
+     */
+    InjectionInterface::Owner &owner(const void *owner);
+
+
+    /**
+     * Applies all patches associated with the given owner
+     * The patches are applied in the order of the registration of the injections.
+     * @param owner Owner of the element
+     */
+    void apply(const void *owner);
+
+
+    /**
+     * Applies all patches associated with the given owner to the given base address
+     * This is used for owners whose address changes (e.g. rebound buffers), which are registered under a stable key.
+     * @param owner Owner of the element (key)
+     * @param base The actual base address of the owner
+     */
+    void apply(const void *owner, void *base);
+
+
+    /**
+     * Removes all patches associated with the given owner
+     * @param owner Owner of the element
+     */
+    void reset(const void *owner);
+
+
+    /**
+     * Removes the owner and detaches its injections
+     * @param owner Owner to be removed
+     */
+    void remove(const void *owner);
+
+
+    /**
+     * Adds a patch to the owner directly, without a registered injection object
+     * @param owner Owner entry
+     * @param offset Byte offset of the target value relative to the owner
+     * @param value Pointer to the value
+     * @param size Size of the value (in *bytes*)
+     */
+    static void inject(InjectionInterface::Owner &owner, std::ptrdiff_t offset, const void *value, size_t size);
+
+
+    /**
+     * Returns the number of registered owners
+     * @return Number of owners
+     */
+    size_t size() const { return _owners.size(); }
+
+
+protected:
+
+    /**
+     * Returns the entry of the given owner
+     * @param owner Owner
+     * @return The owner entry or nullptr, if the owner is not registered
+     */
+    InjectionInterface::Owner *find(const void *owner) const;
+
+};
+
+
+#endif // DATA_GENERATOR_REGISTRY_H
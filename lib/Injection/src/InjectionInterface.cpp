@@ -18,45 +18,67 @@
  * date: 2020-02-16
  */
 
+#include <algorithm>
+#include <cstring>
 #include "InjectionInterface.h"
+#include "InjectionRegistry.h"
 
-std::map<const void *, std::vector<InjectionInterface *>> InjectionInterface::_index{};
 
+InjectionInterface::~InjectionInterface() {
 
-void InjectionInterface::applyAll(const void *owner) {
+    if (_owner == nullptr)
+        return;
 
-    // iterate over elements and apply
-    for (auto &e : _index.at(owner))
-        e->apply();
+    // remove patch (keeps the value in the arena until reset)
+    if (_patch >= 0) {
+        _owner->patches.erase(_owner->patches.begin() + _patch);
+        for (size_t i = (size_t) _patch; i < _owner->patches.size(); ++i) {
+            if (_owner->patches[i].element != nullptr)
+                _owner->patches[i].element->_patch = (long) i;
+        }
+    }
 
-}
-
-
-void InjectionInterface::resetAll(const void *owner) {
-
-    // iterate over elements and apply
-    for (auto e : _index.at(owner))
-        e->reset();
+    // remove from owner
+    auto &e = _owner->elements;
+    e.erase(std::remove(e.begin(), e.end(), this), e.end());
 
 }
 
 
-void InjectionInterface::registerInjection(const void *owner) {
+void InjectionInterface::registerInjection(InjectionRegistry &registry, const void *key, const void *base,
+                                           const void *target) {
 
-    // create owner index
-    if (_index.find(owner) == _index.end())
-        _index[owner] = std::vector<InjectionInterface *>();
+    // get owner entry (the base is used, if the patches are applied without a base address)
+    auto &entry = registry.owner(key);
+    entry.base = (char *) const_cast<void *>(base);
 
     // add this
-    _index.at(owner).push_back(this);
+    _owner = &entry;
+    _rank = entry.elements.empty() ? 0 : entry.elements.back()->_rank + 1;
+    _offset = (const char *) target - (const char *) base;
+    _patch = -1;
+
+    entry.elements.push_back(this);
 
 }
 
 
-void InjectionInterface::remove(const void *owner) {
+void InjectionInterface::inject(const void *value, size_t size) {
+
+    // replace value, if already injected
+    if (_patch >= 0) {
+        auto &p = _owner->patches[_patch];
+        std::memcpy(_owner->arena.data() + p.data, value, size);
+        return;
+    }
 
-    // delete owner
-    if (_index.find(owner) != _index.end())
-        _index.erase(owner);
+    // add value to arena
+    auto data = _owner->arena.size();
+    _owner->arena.resize(data + size);
+    std::memcpy(_owner->arena.data() + data, value, size);
 
-}
\ No newline at end of file
+    // add patch
+    _patch = (long) _owner->patches.size();
+    _owner->patches.push_back(Patch{_rank, this, _offset, size, data});
+
+}
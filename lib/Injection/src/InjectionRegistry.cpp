@@ -0,0 +1,163 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// InjectionRegistry.cpp
+
+#include <algorithm>
+#include <cstring>
+#include "InjectionRegistry.h"
+
+
+InjectionRegistry::~InjectionRegistry() {
+
+    // detach elements
+    for (auto &o : _owners) {
+        for (auto e : o->elements) {
+            e->_owner = nullptr;
+            e->_patch = -1;
+        }
+    }
+
+}
+
+
+InjectionInterface::Owner &InjectionRegistry::owner(const void *owner) {
+
+    // get existing entry
+    auto entry = find(owner);
+    if (entry != nullptr)
+        return *entry;
+
+    // create entry
+    _owners.emplace_back(new InjectionInterface::Owner);
+    entry = _owners.back().get();
+    entry->key = owner;
+    entry->base = (char *) const_cast<void *>(owner);
+
+    return *entry;
+
+}
+
+
+void InjectionRegistry::apply(const void *owner) {
+
+    // get owner
+    auto o = find(owner);
+    if (o != nullptr)
+        apply(owner, o->base);
+
+}
+
+
+void InjectionRegistry::apply(const void *owner, void *base) {
+
+    // get owner
+    auto o = find(owner);
+    if (o == nullptr)
+        return;
+
+    // keep order of registration (e.g. structs before their members)
+    using Patch = InjectionInterface::Patch;
+    auto byRank = [](const Patch &a, const Patch &b) { return a.rank < b.rank; };
+    if (!std::is_sorted(o->patches.begin(), o->patches.end(), byRank)) {
+
+        std::stable_sort(o->patches.begin(), o->patches.end(), byRank);
+
+        // update patch indexes
+        for (size_t i = 0; i < o->patches.size(); ++i) {
+            if (o->patches[i].element != nullptr)
+                o->patches[i].element->_patch = (long) i;
+        }
+
+    }
+
+    // apply patches
+    for (auto &p : o->patches)
+        std::memcpy((char *) base + p.offset, o->arena.data() + p.data, p.size);
+
+}
+
+
+void InjectionRegistry::reset(const void *owner) {
+
+    // get owner
+    auto o = find(owner);
+    if (o == nullptr)
+        return;
+
+    // unset patches, keep capacity
+    for (auto &p : o->patches) {
+        if (p.element != nullptr)
+            p.element->_patch = -1;
+    }
+
+    o->patches.clear();
+    o->arena.clear();
+
+}
+
+
+void InjectionRegistry::remove(const void *owner) {
+
+    // get owner
+    auto it = std::find_if(_owners.begin(), _owners.end(),
+                           [owner](const std::unique_ptr<InjectionInterface::Owner> &o) { return o->key == owner; });
+
+    if (it == _owners.end())
+        return;
+
+    // detach elements
+    for (auto e : (*it)->elements) {
+        e->_owner = nullptr;
+        e->_patch = -1;
+    }
+
+    // delete owner
+    _owners.erase(it);
+
+}
+
+
+void InjectionRegistry::inject(InjectionInterface::Owner &owner, std::ptrdiff_t offset, const void *value, size_t size) {
+
+    // add value to arena
+    auto data = owner.arena.size();
+    owner.arena.resize(data + size);
+    std::memcpy(owner.arena.data() + data, value, size);
+
+    // add patch (after all registered injections)
+    owner.patches.push_back(InjectionInterface::Patch{DIRECT_RANK, nullptr, offset, size, data});
+
+}
+
+
+InjectionInterface::Owner *InjectionRegistry::find(const void *owner) const {
+
+    for (auto &o : _owners) {
+        if (o->key == owner)
+            return o.get();
+    }
+
+    return nullptr;
+
+}
@@ -31,36 +31,97 @@
 #include "StopHorizon.h"
 #include "Filter.h"
 #include "DistanceTimeInterval.h"
+#include "LaneChangePlan.h"
+#include "TargetSummary.h"
+#include "InputTables.h"
+#include "Pipeline.h"
+
+#if WITH_INJECTION
+#include <injection/InjectionRegistry.h>
+#endif
 
 
 /**
  * @brief The agent model main class
+ * The model is a template over the scalar type T of its interface, horizons and stages. AgentModel is the model with
+ * double values, which is compiled into the library and used by the simulators. With a dual number (@see
+ * agent_model::Dual), a step also calculates the derivatives of all states with respect to the chosen variables, e.g.
+ * the parameters of a driver profile, so a closed-loop run gives the sensitivities of the complete trajectory. The
+ * other scalar types are instantiated by including AgentModelImpl.h. Injections are only applied to the model with
+ * double values.
+ * @tparam T The scalar type of the values
  */
-class AgentModel : public agent_model::Interface {
+template<typename T>
+class BasicAgentModel : public agent_model::BasicInterface<T> {
+
+public:
+
+    typedef agent_model::BasicInterface<T> Base;
+    typedef typename Base::Input Input;
+    typedef typename Base::State State;
+    typedef typename Base::Memory Memory;
+    typedef typename Base::Parameters Parameters;
 
 
 protected:
 
-    agent_model::StopHorizon _stop_horizon{};                         //!< attribute to store the stop points
-    agent_model::VelocityHorizon _vel_horizon{};                      //!< attribute to store the stop points
-    agent_model::Filter _filter{};                                    //!< attribute to store the speed reaction filter
-    agent_model::DistanceTimeInterval _lateral_offset_interval;       //!< attribute to store the lateral offset interval
-    agent_model::DistanceTimeInterval _lane_change_process_interval;  //!< attribute to store the lane change interval
+    using Base::_input;
+    using Base::_state;
+    using Base::_memory;
+    using Base::_param;
+
+    agent_model::BasicStopHorizon<T> _stop_horizon{};                         //!< attribute to store the stop points
+    agent_model::BasicVelocityHorizon<T> _vel_horizon{};                      //!< attribute to store the stop points
+    agent_model::BasicFilter<T> _filter{};                                    //!< attribute to store the speed reaction filter
+    agent_model::BasicDistanceTimeInterval<T> _lateral_offset_interval;       //!< attribute to store the lateral offset interval
+    agent_model::BasicDistanceTimeInterval<T> _lane_change_process_interval;  //!< attribute to store the lane change interval
+    agent_model::BasicLaneChangePlan<T> _lane_change_plan{};                  //!< attribute to store the planned lane changes
+    agent_model::BasicTargetSummary<T> _target_summary{};                     //!< attribute to store the classified targets of the step
+    agent_model::BasicLaneTable<T> _lane_table{};                             //!< attribute to store the lanes of the step by id
+    agent_model::BasicSignalTable<T> _signal_table{};                         //!< attribute to store the signals of the step by type
+
+    const agent_model::BasicTarget<T> *_targets = nullptr;                    //!< attribute to store the bound target span (nullptr: input)
+    unsigned int _num_targets = 0;                                            //!< attribute to store the size of the bound target span
+    const agent_model::BasicSignal<T> *_signals = nullptr;                    //!< attribute to store the bound signal span (nullptr: input)
+    unsigned int _num_signals = 0;                                            //!< attribute to store the size of the bound signal span
+
+    /** @brief An entry of the dispatch list of the stages */
+    struct StageEntry {
+        typename agent_model::BasicPipeline<T>::Function function;  //!< The function to be called
+        void *context;                                              //!< The context of the function
+    };
+
+    StageEntry _stages[agent_model::NUMBER_OF_STAGES]{};                      //!< attribute to store the dispatch list of the enabled stages
+    unsigned int _stages_end[3]{};                                            //!< attribute to store the ends of the decision, conscious and subconscious entries
+    bool _lateral_intervals = true;                                           //!< attribute to store whether the lateral intervals are updated
+    bool _mobil = false;                                                      //!< attribute to store whether discretionary lane changes are decided
+    agent_model::BasicReactions<T> _reactions{};                              //!< attribute to store the reactions of the subconscious stages
+
+#if WITH_INJECTION
+    InjectionRegistry _injections{};                                          //!< attribute to store the injections of this instance
+#endif
 
 
 public:
 
 
     /**
-     * Default constructor
+     * Default constructor. All stages are enabled.
+     */
+    BasicAgentModel() : BasicAgentModel(agent_model::BasicPipeline<T>()) {}
+
+
+    /**
+     * Constructor. The dispatch list of the stages is built from the given pipeline.
+     * @param pipeline The configuration of the stages
      */
-    AgentModel() = default;
+    explicit BasicAgentModel(const agent_model::BasicPipeline<T> &pipeline);
 
 
     /**
      * Default destructor
      */
-    ~AgentModel() override = default;
+    ~BasicAgentModel() override = default;
 
 
     /**
@@ -77,6 +138,66 @@ public:
     void step(double simulationTime);
 
 
+    /**
+     * Returns the size of the buffer needed to store a snapshot of the current model state
+     * @return Size of the snapshot (in *bytes*)
+     */
+    size_t snapshotSize() const;
+
+
+    /**
+     * Saves the complete model state (interface and internal states) into the given buffer.
+     * The buffer is flat and relocatable, i.e. it can be copied or stored and restored later.
+     * @param buffer Buffer with at least snapshotSize() bytes
+     * @return The number of bytes written
+     */
+    size_t saveSnapshot(void *buffer) const;
+
+
+    /**
+     * Restores the complete model state from the given snapshot buffer (@see saveSnapshot())
+     * The buffer is checked completely before the model is changed, so an invalid or truncated buffer throws an
+     * std::invalid_argument and leaves the model untouched.
+     * @param buffer Buffer containing the snapshot
+     * @param size Size of the buffer (in *bytes*)
+     */
+    void restoreSnapshot(const void *buffer, size_t size);
+
+
+    /**
+     * Binds the targets to a caller-provided span, which replaces Input::targets (and Input::numTargets) in the
+     * following steps. The span may contain more than NOT targets, the classification is reserved for its size. The
+     * span is neither part of the snapshots nor injected, and copies of the model refer to the same span.
+     * @param targets The targets (must outlive the binding, nullptr: use the input again)
+     * @param n The number of targets
+     */
+    void bindTargets(const agent_model::BasicTarget<T> *targets, unsigned int n);
+
+
+    /**
+     * Binds the signals to a caller-provided span, which replaces Input::signals (and Input::numSignals) in the
+     * following steps (@see bindTargets())
+     * @param signals The signals (must outlive the binding, nullptr: use the input again)
+     * @param n The number of signals
+     */
+    void bindSignals(const agent_model::BasicSignal<T> *signals, unsigned int n);
+
+
+#if WITH_INJECTION
+    /**
+     * Returns the injection registry of this instance. The step applies the owner entries keyed by
+     * agent_model::injectionKey() of INJECTION_PARAMETERS, INJECTION_INPUT and INJECTION_MEMORY (before the decisions),
+     * INJECTION_DECISIONS, INJECTION_CONSCIOUS and INJECTION_SUBCONSCIOUS (after the corresponding stages). The offsets
+     * of the patches are relative to the corresponding struct. Injections shall be created by
+     * agent_model::resolveInjection() or agent_model::registerInjection(), other owner entries are not applied.
+     * @return The injection registry
+     */
+    InjectionRegistry *getInjectionRegistry() {
+        return &_injections;
+    }
+#endif
+
+
 protected:
 
     /**
@@ -91,6 +212,12 @@ protected:
     void decisionLaneChange();
 
 
+    /**
+     * Calculates the decision to perform a discretionary lane change by the MOBIL model
+     */
+    void decisionDiscretionaryLaneChange();
+
+
     /**
      * Calculates the decision to perform a lateral offset
      */
@@ -136,38 +263,43 @@ protected:
      * Calculates the reaction for the lateral motion control based on the reference points
      * @return The reaction value for lateral motion control
      */
-    double subconsciousLateralControl();
+    T subconsciousLateralControl();
 
 
     /**
      * Calculates the reaction to follow other traffic participants
      * @return The reaction value to follow
      */
-    double subconsciousFollow();
+    T subconsciousFollow();
 
 
     /**
      * Calculates the reaction to stop the vehicle at the desired point
      * @return The reaction value to stop
      */
-    double subconsciousStop();
+    T subconsciousStop();
 
 
     /**
      * Calculates the reaction to reach the desired speed, including predictive control
      * @return The reaction value to control speed
      */
-    double subconsciousSpeed();
+    T subconsciousSpeed();
 
 
     /**
      * Calculates the pedal behavior when starting or stopping for sub-microscopic simulations
      * @return The pedal value
      */
-    double subconsciousStartStop();
+    T subconsciousStartStop();
 
 
 };
 
 
+typedef BasicAgentModel<double> AgentModel; //!< The agent model with double values (compiled into the library)
+
+extern template class BasicAgentModel<double>;
+
+
 #endif // AGENT_MODEL_H
@@ -0,0 +1,747 @@
+// Copyright (c) 2019 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by Jens Klimke on 2019-03-23.
+// Contributors:
+//
+// AgentModelImpl.h
+
+#ifndef AGENT_MODEL_IMPL_H
+#define AGENT_MODEL_IMPL_H
+
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "AgentModel.h"
+#include "LongitudinalStages.h"
+#include "model_collection.h"
+
+#if WITH_INJECTION
+#include <injection/Injection.h>
+#include "AgentModelInjection.h"
+#define AGENT_MODEL_APPLY(OWNER, PNTR) if (std::is_same<T, double>::value) { \
+    _injections.apply(agent_model::injectionKey(OWNER), PNTR); \
+    _injections.reset(agent_model::injectionKey(OWNER)); }
+#else
+#define AGENT_MODEL_APPLY(OWNER, PNTR)
+#endif
+
+static const double AM_CLOSE_TO_ONE = 0.999999999;
+
+
+template<typename T>
+BasicAgentModel<T>::BasicAgentModel(const agent_model::BasicPipeline<T> &pipeline) {
+
+    using namespace agent_model;
+
+    // built-in stages
+    static const typename BasicPipeline<T>::Function builtIn[NUMBER_OF_STAGES] = {
+            [](BasicAgentModel &m, BasicReactions<T> &, void *) { m.decisionLaneChange(); },                // open
+            [](BasicAgentModel &m, BasicReactions<T> &, void *) { m.decisionProcessStop(); },               // done: Test 10.1, 10.2
+            [](BasicAgentModel &m, BasicReactions<T> &, void *) { m.decisionLateralOffset(); },             // done: no implementation yet
+            [](BasicAgentModel &m, BasicReactions<T> &, void *) { m.consciousLaneChange(); },               // open
+            [](BasicAgentModel &m, BasicReactions<T> &, void *) { m.consciousVelocity(); },                 // done: Test 9.1, 9.2, 9.3
+            [](BasicAgentModel &m, BasicReactions<T> &, void *) { m.consciousStop(); },                     // done: Test 3.3b, 3.3c
+            [](BasicAgentModel &m, BasicReactions<T> &, void *) { m.consciousFollow(); },                   // done: Test 8.1, 8.2, 8.3
+            [](BasicAgentModel &m, BasicReactions<T> &, void *) { m.consciousLateralOffset(); },            // done: Test 7.3
+            [](BasicAgentModel &m, BasicReactions<T> &, void *) { m.consciousReferencePoints(); },          // done: Test 7.1, 7.2, 7.3, 7.4
+            [](BasicAgentModel &m, BasicReactions<T> &r, void *) { r.speed = m.subconsciousSpeed(); },      // done: Test 2.1, 2.2, 2.3, 3.1, 3.2, 3.6
+            [](BasicAgentModel &m, BasicReactions<T> &r, void *) { r.stop = m.subconsciousStop(); },        // done: Test 3.3, 3.6
+            [](BasicAgentModel &m, BasicReactions<T> &r, void *) { r.follow = m.subconsciousFollow(); },    // done: Test 3.4, 3.5, 3.6
+            [](BasicAgentModel &m, BasicReactions<T> &r, void *) { r.pedal = m.subconsciousStartStop(); },  // done: Test 1.1, 1.2
+            [](BasicAgentModel &m, BasicReactions<T> &r, void *) { r.kappa = m.subconsciousLateralControl(); } // done: Test 6.1, 6.2, 6.3, 6.4
+    };
+
+    // build dispatch list of the enabled stages
+    unsigned int n = 0;
+    for (unsigned int i = 0; i < NUMBER_OF_STAGES; ++i) {
+
+        // end of decision and conscious layer
+        if (i == STAGE_FIRST_CONSCIOUS)
+            _stages_end[0] = n;
+        else if (i == STAGE_FIRST_SUBCONSCIOUS)
+            _stages_end[1] = n;
+
+        auto stage = (Stage) i;
+        if (!pipeline.enabled(stage))
+            continue;
+
+        auto f = pipeline.function(stage);
+        _stages[n++] = f ? StageEntry{f, pipeline.context(stage)} : StageEntry{builtIn[i], nullptr};
+
+    }
+
+    _stages_end[2] = n;
+
+    // the intervals are only needed by the lateral stages
+    _lateral_intervals = pipeline.enabled(STAGE_CONSCIOUS_LANE_CHANGE)
+            || pipeline.enabled(STAGE_CONSCIOUS_LATERAL_OFFSET);
+
+    // discretionary lane changes
+    _mobil = pipeline.mobil();
+
+}
+
+
+template<typename T>
+void BasicAgentModel<T>::init() {
+
+    // unset distance counter
+    _memory.vehicle.s = 0.0;
+
+    // unset lane change
+    _memory.laneChange.switchLane = 0;
+    _memory.laneChange.decision = 0;
+
+    // unset lateral control memory
+    _memory.lateral.startDistance   = INFINITY;
+    _memory.lateral.startTime       = INFINITY;
+
+    // unset velocity
+    _memory.velocity = INFINITY;
+
+    // set lane change
+    _memory.laneChange.startTime = INFINITY;
+
+    // init horizon
+    _stop_horizon.init(_input->vehicle.s);
+    _vel_horizon.init(_input->vehicle.s, 401);
+    _filter.init(10);
+
+    // init lateral control
+    _lateral_offset_interval.reset();
+    _lateral_offset_interval.setScale(0.0);
+
+    // init lane change process and plan
+    _lane_change_plan.reset();
+    _lane_change_process_interval.reset();
+    _lane_change_process_interval.setDelta(0.3);
+    _lane_change_process_interval.setScale(0.0);
+
+    // init road priorities
+    _state->conscious.stop.priority = false;
+    _state->conscious.stop.give_way = false;
+
+}
+
+
+template<typename T>
+void BasicAgentModel<T>::step(double simulationTime) {
+
+    // TODO: Think about using fixed horizon points. This would avoid changing curvature.
+
+    // apply injection for parameters and inputs
+    AGENT_MODEL_APPLY(agent_model::INJECTION_PARAMETERS, &this->_param)
+    AGENT_MODEL_APPLY(agent_model::INJECTION_INPUT, this->_input)
+    AGENT_MODEL_APPLY(agent_model::INJECTION_MEMORY, &this->_memory)
+
+    // update internal horizons
+    _stop_horizon.update(_input->vehicle.s, simulationTime);
+    _vel_horizon.update(_input->vehicle.s);
+    if (_lateral_intervals) {
+        _lateral_offset_interval.update(_input->vehicle.s, simulationTime);
+        _lane_change_process_interval.update(_input->vehicle.s, simulationTime);
+    }
+
+    // set time
+    _state->simulationTime = simulationTime;
+
+    // classify targets (shared by the decision and conscious stages), either of the input or of the bound span
+    if (_targets)
+        _target_summary.update(_targets, _num_targets);
+    else
+        _target_summary.update(_input->targets, agent_model::count(_input->countsValid, _input->numTargets, agent_model::NOT));
+
+    // build lane and signal lookup tables
+    _lane_table.update(_input->lanes, agent_model::count(_input->countsValid, _input->numLanes, agent_model::NOL));
+    if (_signals)
+        _signal_table.update(_signals, _num_signals);
+    else
+        _signal_table.update(_input->signals, agent_model::count(_input->countsValid, _input->numSignals, agent_model::NOS));
+
+    // decisions
+    for (unsigned int i = 0; i < _stages_end[0]; ++i)
+        _stages[i].function(*this, _reactions, _stages[i].context);
+
+    // apply injection for decision
+    AGENT_MODEL_APPLY(agent_model::INJECTION_DECISIONS, &this->_state->decisions)
+
+    // conscious calculation
+    for (unsigned int i = _stages_end[0]; i < _stages_end[1]; ++i)
+        _stages[i].function(*this, _reactions, _stages[i].context);
+
+    // apply injection for conscious states
+    AGENT_MODEL_APPLY(agent_model::INJECTION_CONSCIOUS, &this->_state->conscious)
+
+    // calculate speed, stop and follow reactions, pedal and curvature
+    for (unsigned int i = _stages_end[1]; i < _stages_end[2]; ++i)
+        _stages[i].function(*this, _reactions, _stages[i].context);
+
+    // calculate resulting acceleration
+    T aRes = _param.velocity.a * (1.0 - _reactions.speed - _reactions.stop - _reactions.follow);
+
+    // set desired values
+    _state->subconscious.a     = std::min(std::max(T(-10.0), aRes), T(10.0));           // done: Test 1.3
+    _state->subconscious.kappa = _reactions.kappa; // done: Test 4.1, 4.2
+    _state->subconscious.pedal = _reactions.pedal; // done: Test 1.4
+    _state->subconscious.steering = INFINITY;
+
+    // apply injection for sub-conscious states
+    AGENT_MODEL_APPLY(agent_model::INJECTION_SUBCONSCIOUS, &this->_state->subconscious)
+
+    // save values to memory
+    _memory.vehicle.s = _input->vehicle.s;
+
+}
+
+
+template<typename T>
+void BasicAgentModel<T>::bindTargets(const agent_model::BasicTarget<T> *targets, unsigned int n) {
+
+    _targets = targets;
+    _num_targets = targets ? n : 0;
+
+    // no allocation during the steps
+    _target_summary.reserve(_num_targets);
+
+}
+
+
+template<typename T>
+void BasicAgentModel<T>::bindSignals(const agent_model::BasicSignal<T> *signals, unsigned int n) {
+
+    _signals = signals;
+    _num_signals = signals ? n : 0;
+
+    // no allocation during the steps
+    _signal_table.reserve(_num_signals);
+
+}
+
+
+template<typename T>
+size_t BasicAgentModel<T>::snapshotSize() const {
+
+    return sizeof(agent_model::snapshot::Header)
+           + sizeof(Input) + sizeof(State) + sizeof(_memory) + sizeof(_param)
+           + _stop_horizon.snapshotSize()
+           + _vel_horizon.snapshotSize()
+           + _filter.snapshotSize()
+           + _lateral_offset_interval.snapshotSize()
+           + _lane_change_process_interval.snapshotSize()
+           + _lane_change_plan.snapshotSize();
+
+}
+
+
+template<typename T>
+size_t BasicAgentModel<T>::saveSnapshot(void *buffer) const {
+
+    using namespace agent_model;
+
+    // create header
+    snapshot::Header header{snapshot::MAGIC, snapshot::VERSION, snapshotSize()};
+    auto b = snapshot::write((char *) buffer, header);
+
+    // write interface
+    b = snapshot::write(b, *_input);
+    b = snapshot::write(b, *_state);
+    b = snapshot::write(b, _memory);
+    b = snapshot::write(b, _param);
+
+    // write internal states
+    b = _stop_horizon.save(b);
+    b = _vel_horizon.save(b);
+    b = _filter.save(b);
+    b = _lateral_offset_interval.save(b);
+    b = _lane_change_process_interval.save(b);
+    b = _lane_change_plan.save(b);
+
+    return (size_t) header.size;
+
+}
+
+
+template<typename T>
+void BasicAgentModel<T>::restoreSnapshot(const void *buffer, size_t size) {
+
+    using namespace agent_model;
+
+    // read header
+    snapshot::Header header{};
+    if (size < sizeof(header))
+        throw std::invalid_argument("snapshot buffer is too small.");
+
+    auto b = snapshot::read((const char *) buffer, header);
+
+    // check header
+    if (header.magic != snapshot::MAGIC || header.version != snapshot::VERSION || header.size < sizeof(header))
+        throw std::invalid_argument("snapshot buffer is invalid.");
+    else if (header.size > size)
+        throw std::invalid_argument("snapshot buffer is too small.");
+
+    // check all sections before any member is overwritten
+    auto end = (const char *) buffer + header.size;
+    auto p = b + sizeof(Input) + sizeof(State) + sizeof(_memory) + sizeof(_param);
+    snapshot::require((size_t) (p - b), (size_t) (end - b));
+    p += StopHorizon::checkSnapshot(p, (size_t) (end - p));
+    p += VelocityHorizon::checkSnapshot(p, (size_t) (end - p));
+    p += Filter::checkSnapshot(p, (size_t) (end - p));
+    snapshot::require(_lateral_offset_interval.snapshotSize() + _lane_change_process_interval.snapshotSize()
+                      + _lane_change_plan.snapshotSize(), (size_t) (end - p));
+
+    // read interface
+    b = snapshot::read(b, *_input);
+    b = snapshot::read(b, *_state);
+    b = snapshot::read(b, _memory);
+    b = snapshot::read(b, _param);
+
+    // read internal states
+    b = _stop_horizon.restore(b);
+    b = _vel_horizon.restore(b);
+    b = _filter.restore(b);
+    b = _lateral_offset_interval.restore(b);
+    b = _lane_change_process_interval.restore(b);
+    _lane_change_plan.restore(b);
+
+}
+
+
+template<typename T>
+void BasicAgentModel<T>::decisionProcessStop() {
+
+    agent_model::decisionProcessStop(*_input, *_state, _lane_table.lane(0), _param, _signal_table, _target_summary);
+
+}
+
+template<typename T>
+void BasicAgentModel<T>::decisionLaneChange() {
+
+    // check for route-based lane changes
+    _state->decisions.laneChangeInt = 0; // intention
+    _state->decisions.laneChangeDec = 0; // decision
+
+    // shift the plan after a finished lane change
+    _lane_change_plan.switched(_memory.laneChange.switchLane);
+
+    // determine velocity dependend required length (assumption: v is constant)
+    T safety_factor = 1.0;
+    T length = _param.laneChange.time * _input->vehicle.v * safety_factor;
+
+    // get current lane pointer
+    auto ego = _lane_table.lane(0);
+
+    // skip if ego lane not found
+    if (!ego) return;
+
+    int lane_change_status = ego->lane_change;
+    
+    // skip if lane_change not desired (only discretionary lane changes)
+    if (lane_change_status < 1) {
+        _lane_change_plan.reset();
+        if (_mobil)
+            decisionDiscretionaryLaneChange();
+        return;
+    }
+
+    // plan towards the lane with the longest route (possibly several lanes away), change to the next lane of the plan
+    auto target = _lane_change_plan.update(_lane_table, length);
+    _state->decisions.laneChangeInt = target > 0 ? 1 : (target < 0 ? -1 : 0);
+
+    // if lane_change intended
+    if (_state->decisions.laneChangeInt != 0) {
+        
+        _state->decisions.laneChangeDec = _state->decisions.laneChangeInt;
+
+        // allow later lane change if still enough route available
+        if (lane_change_status == 2 && ego->route > length) {
+            lane_change_status = 1;
+        }
+
+        // skip lane change if route to short and later possible (status 1)
+        if (ego->route < length && lane_change_status == 1) {
+            _state->decisions.laneChangeDec = 0;
+            return;
+        }
+
+        // consider targets when status == 1
+        if (lane_change_status == 1) {
+
+            // only within critical thw
+            T thw_crit = 1.0;
+            T safety_boundary = 5.0;
+
+            // targets on lane
+            unsigned int nl;
+            auto lane = _target_summary.lane(_state->decisions.laneChangeInt, nl);
+            for (unsigned int j = 0; j < nl; ++j) {
+
+                // get target
+                auto tar = &_target_summary.target(lane[j]);
+
+                // caculate dv and s_crit
+                T dv = _input->vehicle.v - tar->v;
+                T s_crit = thw_crit * dv;
+
+                // skip lane change if too close
+                if (abs(tar->ds) < safety_boundary) {
+                    _state->decisions.laneChangeDec = 0;
+                    break; 
+                }
+
+                // if ego vehicle is faster - target in front is critical
+                if (dv > 0 && tar->ds > safety_boundary && tar->ds < s_crit) {
+                    _state->decisions.laneChangeDec = 0;
+                    break; 
+                }
+                // if ego vehicle is slower - target in back is critical
+                if (dv < 0 && tar->ds < -safety_boundary && tar->ds > s_crit) {
+                    _state->decisions.laneChangeDec = 0;
+                    break; 
+                }
+            }
+        }
+    }
+
+}
+
+
+template<typename T>
+void BasicAgentModel<T>::decisionDiscretionaryLaneChange() {
+
+    typedef agent_model::BasicTargetSummary<T> TargetSummary;
+
+    // candidate lanes (left and right, the neighbouring lanes first)
+    static const int N = 2 * TargetSummary::NEIGHBOURS;
+    static const int lanes[N] = {1, -1, 2, -2};
+
+    // keep the intention during the lane change, no new decision
+    if (_lane_change_process_interval.isSet()) {
+        _state->decisions.laneChangeInt = _memory.laneChange.decision;
+        return;
+    }
+
+    // net distance and velocity of the nearest target ahead or behind (no target: infinite distance)
+    auto nearest = [this](unsigned int i, double sign, T &ds, T &v) {
+
+        ds = sign * INFINITY;
+        v = 0.0;
+
+        if (i != TargetSummary::NONE) {
+            auto &t = _target_summary.target(i);
+            ds = t.ds - sign * (t.size.length * 0.5 + _param.vehicle.size.length * 0.5) + _param.vehicle.pos.x;
+            v = t.v;
+        }
+
+    };
+
+    // a lane is available, if the lane and all lanes in between are accessible and keep the route. The lanes beyond
+    // the neighbours are only available if targets are reported on them: a target source may not cover these lanes,
+    // and an uncovered lane must not look like an empty one.
+    auto ego = _lane_table.lane(0);
+    bool available[N];
+    for (int i = 0; i < N; ++i) {
+        auto lane = _lane_table.lane(lanes[i]);
+        available[i] = lane && lane->access == agent_model::ACC_ACCESSIBLE && lane->route >= ego->route
+                && (i < 2 || (available[i - 2] && (_target_summary.leader(lanes[i]) != TargetSummary::NONE
+                                                    || _target_summary.follower(lanes[i]) != TargetSummary::NONE)));
+    }
+
+    // targets on the ego lane and on the candidate lanes (from the classified targets)
+    T dsEF, vEF, dsEB, vEB;
+    nearest(_target_summary.leader(0), 1.0, dsEF, vEF);
+    nearest(_target_summary.follower(0), -1.0, dsEB, vEB);
+
+    T dsF[N], vF[N], dsB[N], vB[N];
+    for (int i = 0; i < N; ++i) {
+        nearest(_target_summary.leader(lanes[i]), 1.0, dsF[i], vF[i]);
+        nearest(_target_summary.follower(lanes[i]), -1.0, dsB[i], vB[i]);
+    }
+
+    // evaluate all candidates in one pass
+    T safety[N], incentive[N];
+    agent_model::MOBILBatch(safety, incentive, N, _input->vehicle.v, _param.velocity.vComfort,
+                            _param.follow.timeHeadway, _param.follow.dsStopped, _param.velocity.a, -_param.velocity.b,
+                            dsEF, vEF, dsEB, vEB, dsF, vF, dsB, vB,
+                            _param.laneChange.bSafe, _param.laneChange.aThreshold, _param.laneChange.politenessFactor);
+
+    // take the safe candidate with the largest incentive (lanes beyond must be safe on the lanes in between as well)
+    int best = -1;
+    for (int i = 0; i < N; ++i) {
+
+        bool safe = safety[i] > 0.999 && (i < 2 || safety[i - 2] > 0.999);
+        if (available[i] && safe && incentive[i] > 0.0 && (best < 0 || incentive[i] > incentive[best]))
+            best = i;
+
+    }
+
+    // change one lane at a time towards the candidate
+    int direction = best < 0 ? 0 : (lanes[best] > 0 ? 1 : -1);
+    _state->decisions.laneChangeInt = direction;
+    _state->decisions.laneChangeDec = direction;
+
+}
+
+
+template<typename T>
+void BasicAgentModel<T>::decisionLateralOffset() {
+
+    _state->decisions.lateral.distance = INFINITY;
+    _state->decisions.lateral.time = INFINITY;
+    _state->decisions.lateral.value = 0.0;
+
+}
+
+
+template<typename T>
+void BasicAgentModel<T>::consciousVelocity() {
+
+    agent_model::consciousVelocity(*_input, *_state, _memory, _param, _vel_horizon, _signal_table);
+
+}
+
+
+template<typename T>
+void BasicAgentModel<T>::consciousStop() {
+
+    agent_model::consciousStop(*_input, *_state, _param, _stop_horizon);
+
+}
+
+
+template<typename T>
+void BasicAgentModel<T>::consciousFollow() {
+
+    agent_model::consciousFollow(*_input, *_state, _param, _target_summary,
+                                 _state->decisions.laneChangeInt, _lane_change_process_interval.getFactor());
+
+}
+
+
+template<typename T>
+void BasicAgentModel<T>::consciousLaneChange() {
+
+    using namespace std;
+
+    if(_state->decisions.laneChangeDec != 0 && !_lane_change_process_interval.isSet()) {
+
+        // start process
+        _lane_change_process_interval.setTimeInterval(_param.laneChange.time);
+        _lane_change_process_interval.setScale(1.0 * _state->decisions.laneChangeDec);
+        _memory.laneChange.decision = _state->decisions.laneChangeDec;
+
+    }
+
+    // calculate factor and limit
+    _memory.laneChange.switchLane = 0;
+    auto factor = _lane_change_process_interval.getScaledFactor();
+    factor = std::max(T(-1.0), std::min(T(1.0), factor));
+
+    // lane change has ended
+    if(_lane_change_process_interval.getFactor() >= AM_CLOSE_TO_ONE) {
+
+        // set lane change flag
+        _memory.laneChange.switchLane = factor < 0.0 ? -1 : 1;
+
+        // reset process
+        _lane_change_process_interval.reset();
+        _lane_change_process_interval.setScale(0.0);
+        _memory.laneChange.decision = 0;
+    }
+
+    // set factor (multi-lane changes are performed lane by lane, @see LaneChangePlan)
+    _state->conscious.lateral.paths[0].factor = (1.0 - abs(factor));
+    _state->conscious.lateral.paths[1].factor = std::max(T(0.0), -factor);
+    _state->conscious.lateral.paths[2].factor = std::max(T(0.0),  factor);
+
+}
+
+
+template<typename T>
+void BasicAgentModel<T>::consciousLateralOffset() {
+
+    using namespace std;
+
+
+    // check decision and set
+    if(!isinf(_state->decisions.lateral.distance) || !isinf(_state->decisions.lateral.time)) {
+
+        // save current offset
+        _memory.lateral.offset = _input->vehicle.d;
+
+        // reset
+        _lateral_offset_interval.reset();
+
+        // set intervals
+        _lateral_offset_interval.setEndPosition(_input->vehicle.s + _state->decisions.lateral.distance);
+        _lateral_offset_interval.setTimeInterval(_state->decisions.lateral.time);
+        _lateral_offset_interval.setScale(_state->decisions.lateral.value);
+
+    }
+
+    // calculate factor and get scale
+    auto factor = _lateral_offset_interval.getFactor();
+    auto offset = _lateral_offset_interval.getScale();
+
+    // set state
+    _state->conscious.lateral.paths[0].offset = _memory.lateral.offset * (1.0 - factor) + offset * factor;
+
+}
+
+
+template<typename T>
+void BasicAgentModel<T>::consciousReferencePoints() {
+
+    using namespace std;
+
+    // get speed and offset
+    auto v = _input->vehicle.v;
+    auto nh = agent_model::count(_input->countsValid, _input->numHorizon, agent_model::NOH);
+
+    // calculate reference points
+    for (size_t i = 0; i < agent_model::NORP; ++i) {
+
+        // get grid point
+        T s = std::max(_param.steering.dsMin[i], v * _param.steering.thw[i]);
+
+        // no interpolation possible (e.g. horizon ended) -> set horizon straight ahead
+        if (nh < 2 || isinf(_input->horizon.ds[1])) {
+
+            // set all paths equal
+            _state->conscious.lateral.paths[0].refPoints[i] = {s, 0.0, 0.0, 0.0};  // ego
+            _state->conscious.lateral.paths[1].refPoints[i] = {s, 0.0, 0.0, 0.0};  // left
+            _state->conscious.lateral.paths[2].refPoints[i] = {s, 0.0, 0.0, 0.0};  // right
+
+            // next loop step
+            continue;
+        }
+
+        // get lane offsets
+        auto offR = -agent_model::interpolate(s, _input->horizon.ds, _input->horizon.rightLaneOffset, nh, 2);
+        auto offL = agent_model::interpolate(s, _input->horizon.ds, _input->horizon.leftLaneOffset, nh, 2);
+
+        // interpolate angle and do the rotation math
+        auto psi = agent_model::interpolate(s, _input->horizon.ds, _input->horizon.psi, nh, 2);
+        T sn = sin(psi), cn = cos(psi);
+
+        // get offset
+        auto off = _state->conscious.lateral.paths[0].offset;
+
+        // interpolate x and y
+        auto x = agent_model::interpolate(s, _input->horizon.ds, _input->horizon.x, nh, 2) + _param.vehicle.pos.x - sn * off;
+        auto y = agent_model::interpolate(s, _input->horizon.ds, _input->horizon.y, nh, 2) + _param.vehicle.pos.y + cn * off;
+
+        // calculate reference points
+        // TODO: calculate dx, dy (independent on change in speed => dv/dt = 0 to avoid influence of speed change in reference points)
+        auto re = agent_model::BasicDynamicPosition<T>{x, y, 0.0, 0.0};
+        auto rr = agent_model::BasicDynamicPosition<T>{x - sn * offR, y + cn * offR, 0.0, 0.0};
+        auto rl = agent_model::BasicDynamicPosition<T>{x - sn * offL, y + cn * offL, 0.0, 0.0};
+
+        // write data
+        _state->conscious.lateral.paths[0].refPoints[i] = re;  // ego
+        _state->conscious.lateral.paths[1].refPoints[i] = rr;  // right
+        _state->conscious.lateral.paths[2].refPoints[i] = rl;  // left
+    }
+}
+
+
+template<typename T>
+T BasicAgentModel<T>::subconsciousLateralControl() {
+
+    // initialize reaction
+    T reaction = 0.0;
+
+    // reset last aux entry
+    _state->aux[31] = 0.0;
+
+    // iterate over reference points
+    for (unsigned int i = 0; i < agent_model::NORP; ++i) {
+
+        // parameters
+        auto P = _param.steering.P[i];
+        auto D = _param.steering.D[i];
+
+        // iterate over control paths
+        for (size_t j = 0; j < agent_model::NOCP; ++j) {
+
+            // get reference points with derivatives
+            auto x = _state->conscious.lateral.paths[j].refPoints[i].x;
+            auto y = _state->conscious.lateral.paths[j].refPoints[i].y;
+            auto dx = _state->conscious.lateral.paths[j].refPoints[i].dx;
+            auto dy = _state->conscious.lateral.paths[j].refPoints[i].dy;
+
+            // generate index for aux vector (theta and dtheta/dt are stored in aux)
+            auto idx = 2 * (i * agent_model::NOCP + j);
+
+            // calculate salvucci and gray and apply factor
+            reaction += _state->conscious.lateral.paths[j].factor
+                    * agent_model::SalvucciAndGray(x, y, dx, dy, P, D, _state->aux[idx + 0], _state->aux[idx + 1]);
+
+            // save factored value
+            _state->aux[31] += _state->conscious.lateral.paths[j].factor * _state->aux[idx];
+
+        }
+    }
+
+    // reset temporary theta and dTheta
+    if (_memory.laneChange.switchLane != 0) {
+        for (int i = 0; i < agent_model::NOCP * agent_model::NORP * 2; i++) 
+            _state->aux[i] = 0;
+    }
+
+    return reaction;
+}
+
+template<typename T>
+T BasicAgentModel<T>::subconsciousFollow() {
+
+    return agent_model::subconsciousFollow(*_input, *_state, _param);
+
+}
+
+
+template<typename T>
+T BasicAgentModel<T>::subconsciousStop() {
+
+    return agent_model::subconsciousStop(*_input, *_state, _param);
+
+}
+
+
+template<typename T>
+T BasicAgentModel<T>::subconsciousSpeed() {
+
+    return agent_model::subconsciousSpeed(*_input, *_state, _filter);
+
+}
+
+
+template<typename T>
+T BasicAgentModel<T>::subconsciousStartStop() {
+
+    return agent_model::subconsciousStartStop(*_state, _param);
+
+}
+
+
+#endif // AGENT_MODEL_IMPL_H
@@ -23,270 +23,108 @@
 //
 
 
+#include <cstring>
 #include "AgentModelInjection.h"
+#include "AgentModel.h"
 
 namespace agent_model {
 
 
-    void registerTree(__Position *tree, Position *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->x.registerValue(&data->x, owner);
-        tree->y.registerValue(&data->y, owner);
-    }
-
-    void registerTree(__DynamicPosition *tree, DynamicPosition *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->x.registerValue(&data->x, owner);
-        tree->y.registerValue(&data->y, owner);
-        tree->dx.registerValue(&data->dx, owner);
-        tree->dy.registerValue(&data->dy, owner);
-    }
-
-    void registerTree(__Point *tree, Point *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->distance.registerValue(&data->distance, owner);
-        tree->time.registerValue(&data->time, owner);
-        tree->value.registerValue(&data->value, owner);
-    }
-
-    void registerTree(__Dimensions *tree, Dimensions *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->width.registerValue(&data->width, owner);
-        tree->length.registerValue(&data->length, owner);
-    }
-
-    void registerTree(__VehicleState *tree, VehicleState *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->v.registerValue(&data->v, owner);
-        tree->a.registerValue(&data->a, owner);
-        tree->psi.registerValue(&data->psi, owner);
-        tree->dPsi.registerValue(&data->dPsi, owner);
-        tree->s.registerValue(&data->s, owner);
-        tree->d.registerValue(&data->d, owner);
-        tree->pedal.registerValue(&data->pedal, owner);
-        tree->steering.registerValue(&data->steering, owner);
-    }
-
-    void registerTree(__Horizon *tree, Horizon *data, const void *owner) {
-        tree->registerValue(data, owner);
-        registerArray(&tree->ds[0], &data->ds[0], owner, {NOH});
-        registerArray(&tree->x[0], &data->x[0], owner, {NOH});
-        registerArray(&tree->y[0], &data->y[0], owner, {NOH});
-        registerArray(&tree->psi[0], &data->psi[0], owner, {NOH});
-        registerArray(&tree->kappa[0], &data->kappa[0], owner, {NOH});
-        registerArray(&tree->egoLaneWidth[0], &data->egoLaneWidth[0], owner, {NOH});
-        registerArray(&tree->rightLaneOffset[0], &data->rightLaneOffset[0], owner, {NOH});
-        registerArray(&tree->leftLaneOffset[0], &data->leftLaneOffset[0], owner, {NOH});
-    }
-
-    void registerTree(__Lane *tree, Lane *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->id.registerValue(&data->id, owner);
-        tree->width.registerValue(&data->width, owner);
-        tree->route.registerValue(&data->route, owner);
-        tree->closed.registerValue(&data->closed, owner);
-        tree->dir.registerValue(&data->dir, owner);
-        tree->access.registerValue(&data->access, owner);
-    }
-
-    void registerTree(__ControlPath *tree, ControlPath *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->offset.registerValue(&data->offset, owner);
-        tree->factor.registerValue(&data->factor, owner);
-        registerStructArray(&tree->refPoints[0], &data->refPoints[0], owner, {NORP});
-    }
-
-    void registerTree(__Signal *tree, Signal *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->id.registerValue(&data->id, owner);
-        tree->ds.registerValue(&data->ds, owner);
-        tree->type.registerValue(&data->type, owner);
-        tree->value.registerValue(&data->value, owner);
-    }
-
-    void registerTree(__Target *tree, Target *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->id.registerValue(&data->id, owner);
-        tree->ds.registerValue(&data->ds, owner);
-        registerTree(&tree->xy, &data->xy, owner);
-        tree->v.registerValue(&data->v, owner);
-        tree->a.registerValue(&data->a, owner);
-        tree->d.registerValue(&data->d, owner);
-        tree->psi.registerValue(&data->psi, owner);
-        tree->lane.registerValue(&data->lane, owner);
-        registerTree(&tree->size, &data->size, owner);
-    }
-
-    void registerTree(__DecisionStopping *tree, DecisionStopping *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->id.registerValue(&data->id, owner);
-        tree->position.registerValue(&data->position, owner);
-        tree->standingTime.registerValue(&data->standingTime, owner);
-    }
+    InjectionHandle resolveInjection(AgentModel &agent, const std::string &path) {
 
-    void registerTree(__Decisions *tree, Decisions *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->laneChange.registerValue(&data->laneChangeInt, owner);
-        tree->laneChange.registerValue(&data->laneChangeDec, owner);
-        registerTree(&tree->lateral, &data->lateral, owner);
-        registerTree(&tree->signal, &data->signal, owner);
-        registerTree(&tree->target, &data->target, owner);
-        registerTree(&tree->destination, &data->destination, owner);
-        //registerStructArray(&tree->stopping[0], &data->stopping[0], owner, {NOS});
-    }
+        using namespace reflection;
 
-    void registerTree(__ConsciousVelocity *tree, ConsciousVelocity *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->local.registerValue(&data->local, owner);
-        tree->prediction.registerValue(&data->prediction, owner);
-    }
+        // the roots of the paths, which are applied during the step
+        struct Root {
+            const char *name;
+            InjectionOwner owner;
+            const Field *fields;
+            unsigned int count;
+            size_t size;
+        };
 
-    void registerTree(__ConsciousStop *tree, ConsciousStop *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->ds.registerValue(&data->ds, owner);
-        tree->dsMax.registerValue(&data->dsMax, owner);
-        tree->standing.registerValue(&data->standing, owner);
-    }
+        const Root roots[] = {
+                {"input", INJECTION_INPUT, FieldTable<Input>::fields, FieldTable<Input>::count, sizeof(Input)},
+                {"memory", INJECTION_MEMORY, FieldTable<Memory>::fields, FieldTable<Memory>::count, sizeof(Memory)},
+                {"parameters", INJECTION_PARAMETERS, FieldTable<Parameters>::fields, FieldTable<Parameters>::count,
+                 sizeof(Parameters)},
+                {"state.decisions", INJECTION_DECISIONS, FieldTable<Decisions>::fields, FieldTable<Decisions>::count,
+                 sizeof(Decisions)},
+                {"state.conscious", INJECTION_CONSCIOUS, FieldTable<Conscious>::fields, FieldTable<Conscious>::count,
+                 sizeof(Conscious)},
+                {"state.subconscious", INJECTION_SUBCONSCIOUS, FieldTable<Subconscious>::fields,
+                 FieldTable<Subconscious>::count, sizeof(Subconscious)}
+        };
 
-    void registerTree(__ConsciousFollow *tree, ConsciousFollow *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->distance.registerValue(&data->targets[0].distance, owner);
-        tree->velocity.registerValue(&data->targets[0].velocity, owner);
-        tree->standing.registerValue(&data->standing, owner);
-    }
+        for (auto &root : roots) {
 
-    void registerTree(__ConsciousLateral *tree, ConsciousLateral *data, const void *owner) {
-        tree->registerValue(data, owner);
-        registerStructArray(&tree->paths[0], &data->paths[0], owner, {NOCP});
-    }
+            auto n = std::strlen(root.name);
+            if (path.compare(0, n, root.name) != 0)
+                continue;
 
-    void registerTree(__Conscious *tree, Conscious *data, const void *owner) {
-        tree->registerValue(data, owner);
-        registerTree(&tree->velocity, &data->velocity, owner);
-        registerTree(&tree->stop, &data->stop, owner);
-        registerTree(&tree->follow, &data->follow, owner);
-        registerTree(&tree->lateral, &data->lateral, owner);
-    }
+            // keyed by the part, the address is passed when the patches are applied
+            auto &owner = agent.getInjectionRegistry()->owner(injectionKey(root.owner));
 
-    void registerTree(__Subconscious *tree, Subconscious *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->a.registerValue(&data->a, owner);
-        tree->dPsi.registerValue(&data->dPsi, owner);
-        tree->kappa.registerValue(&data->kappa, owner);
-        tree->pedal.registerValue(&data->pedal, owner);
-        tree->steering.registerValue(&data->steering, owner);
-    }
+            // whole struct
+            if (path.size() == n)
+                return InjectionHandle(&owner, 0, root.size, FIELD_STRUCT);
 
-    void registerTree(__MemoryVehicle *tree, MemoryVehicle *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->s.registerValue(&data->s, owner);
-    }
+            // member
+            if (path[n] != '.')
+                continue;
 
-    void registerTree(__MemoryLateral *tree, MemoryLateral *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->time.registerValue(&data->time, owner);
-        tree->startTime.registerValue(&data->startTime, owner);
-        tree->distance.registerValue(&data->distance, owner);
-        tree->startDistance.registerValue(&data->startDistance, owner);
-        tree->offset.registerValue(&data->offset, owner);
-    }
+            auto res = resolve(root.fields, root.count, path.substr(n + 1));
+            return InjectionHandle(&owner, (std::ptrdiff_t) res.offset, res.size, res.field->type);
 
-    void registerTree(__MemoryLaneChange *tree, MemoryLaneChange *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->switchLane.registerValue(&data->switchLane, owner);
-        tree->decision.registerValue(&data->decision, owner);
-        tree->startTime.registerValue(&data->startTime, owner);
-    }
+        }
 
-    void registerTree(__ParameterVelocityControl *tree, ParameterVelocityControl *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->thwMax.registerValue(&data->thwMax, owner);
-        tree->delta.registerValue(&data->delta, owner);
-        tree->deltaPred.registerValue(&data->deltaPred, owner);
-        tree->a.registerValue(&data->a, owner);
-        tree->b.registerValue(&data->b, owner);
-        tree->vScale.registerValue(&data->vScale, owner);
-        tree->ayMax.registerValue(&data->ayMax, owner);
-        tree->vComfort.registerValue(&data->vComfort, owner);
-    }
+        throw std::invalid_argument("path \"" + path + "\" is not injectable.");
 
-    void registerTree(__ParameterFollowing *tree, ParameterFollowing *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->timeHeadway.registerValue(&data->timeHeadway, owner);
-        tree->dsStopped.registerValue(&data->dsStopped, owner);
-        tree->thwMax.registerValue(&data->thwMax, owner);
     }
 
-    void registerTree(__ParameterVehicle *tree, ParameterVehicle *data, const void *owner) {
-        tree->registerValue(data, owner);
-        registerTree(&tree->size, &data->size, owner);
-        registerTree(&tree->pos, &data->pos, owner);
-    }
 
-    void registerTree(__ParameterSteering *tree, ParameterSteering *data, const void *owner) {
-        tree->registerValue(data, owner);
-        registerArray(&tree->thw[0], &data->thw[0], owner, {NORP});
-        registerArray(&tree->dsMin[0], &data->dsMin[0], owner, {NORP});
-        registerArray(&tree->P[0], &data->P[0], owner, {NORP});
-        registerArray(&tree->D[0], &data->D[0], owner, {NORP});
-    }
+    const void *injectionBase(AgentModel &agent, InjectionOwner owner, const void *value, size_t size) {
 
-    void registerTree(__ParameterStopping *tree, ParameterStopping *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->dsGap.registerValue(&data->dsGap, owner);
-        tree->TMax.registerValue(&data->TMax, owner);
-        tree->dsMax.registerValue(&data->dsMax, owner);
-        tree->T.registerValue(&data->T, owner);
-        tree->tSign.registerValue(&data->tSign, owner);
-        tree->vStopped.registerValue(&data->vStopped, owner);
-        tree->pedalDuringStanding.registerValue(&data->pedalDuringStanding, owner);
-    }
-
-    void registerTree(__ParameterLaneChange *tree, ParameterLaneChange *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->bSafe.registerValue(&data->bSafe, owner);
-        tree->aThreshold.registerValue(&data->aThreshold, owner);
-        tree->politenessFactor.registerValue(&data->politenessFactor, owner);
-        tree->time.registerValue(&data->time, owner);
-    }
+        const void *base = nullptr;
+        size_t length = 0;
 
-    void registerTree(__Input *tree, Input *data, const void *owner) {
-        tree->registerValue(data, owner);
-        registerTree(&tree->vehicle, &data->vehicle, owner);
-        registerTree(&tree->horizon, &data->horizon, owner);
-        registerStructArray(&tree->signals[0], &data->signals[0], owner, {NOS});
-        registerStructArray(&tree->lanes[0], &data->lanes[0], owner, {NOL});
-        registerStructArray(&tree->targets[0], &data->targets[0], owner, {NOT});
-    }
+        switch (owner) {
+            case INJECTION_INPUT:
+                base = agent.getInput();
+                length = sizeof(Input);
+                break;
+            case INJECTION_MEMORY:
+                base = agent.getMemory();
+                length = sizeof(Memory);
+                break;
+            case INJECTION_PARAMETERS:
+                base = agent.getParameters();
+                length = sizeof(Parameters);
+                break;
+            case INJECTION_DECISIONS:
+                base = &agent.getState()->decisions;
+                length = sizeof(Decisions);
+                break;
+            case INJECTION_CONSCIOUS:
+                base = &agent.getState()->conscious;
+                length = sizeof(Conscious);
+                break;
+            case INJECTION_SUBCONSCIOUS:
+                base = &agent.getState()->subconscious;
+                length = sizeof(Subconscious);
+                break;
+            default:
+                throw std::invalid_argument("injection owner is invalid.");
+        }
 
-    void registerTree(__State *tree, State *data, const void *owner) {
-        tree->registerValue(data, owner);
-        tree->simulationTime.registerValue(&data->simulationTime, owner);
-        registerTree(&tree->decisions, &data->decisions, owner);
-        registerTree(&tree->conscious, &data->conscious, owner);
-        registerTree(&tree->subconscious, &data->subconscious, owner);
-        registerArray(&tree->aux[0], &data->aux[0], owner, {NOA});
-    }
+        // check that the value is a member of the part
+        auto b = static_cast<const char *>(base), v = static_cast<const char *>(value);
+        if (base == nullptr || v < b || size > length || v > b + (length - size))
+            throw std::invalid_argument("value is not a member of the injection owner.");
 
-    void registerTree(__Memory *tree, Memory *data, const void *owner) {
-        tree->registerValue(data, owner);
-        registerTree(&tree->vehicle, &data->vehicle, owner);
-        tree->velocity.registerValue(&data->velocity, owner);
-        registerTree(&tree->lateral, &data->lateral, owner);
-        registerTree(&tree->laneChange, &data->laneChange, owner);
-    }
+        return base;
 
-    void registerTree(__Parameters *tree, Parameters *data, const void *owner) {
-        tree->registerValue(data, owner);
-        registerTree(&tree->vehicle, &data->vehicle, owner);
-        registerTree(&tree->laneChange, &data->laneChange, owner);
-        registerTree(&tree->stop, &data->stop, owner);
-        registerTree(&tree->velocity, &data->velocity, owner);
-        registerTree(&tree->follow, &data->follow, owner);
-        registerTree(&tree->steering, &data->steering, owner);
     }
 
 
-
 } // namespace
-
@@ -26,358 +26,152 @@
 #ifndef AGENT_MODEL_REGISTRATION_H
 #define AGENT_MODEL_REGISTRATION_H
 
+#include <string>
+#include <stdexcept>
+#include <type_traits>
 #include <injection/Injection.h>
+#include <injection/InjectionRegistry.h>
+#include "AgentModel.h"
 #include "Interface.h"
+#include "Reflection.h"
 
 namespace agent_model {
 
-    struct __Position : public Injection<Position> {
-        using Injection<Position>::operator =;
-        Injection<double> x;
-        Injection<double> y;
+    /**
+     * @brief The parts of an agent model, to which injections are applied
+     * The owner entries of the injection registry are keyed by these parts instead of their addresses, because the
+     * input and state buffers can be rebound (@see Interface::bind()).
+     */
+    enum InjectionOwner {
+        INJECTION_INPUT,
+        INJECTION_MEMORY,
+        INJECTION_PARAMETERS,
+        INJECTION_DECISIONS,
+        INJECTION_CONSCIOUS,
+        INJECTION_SUBCONSCIOUS,
+        NUMBER_OF_INJECTION_OWNERS
     };
 
-    struct __DynamicPosition : public Injection<DynamicPosition> {
-        using Injection<DynamicPosition>::operator =;
-        Injection<double> x;
-        Injection<double> y;
-        Injection<double> dx;
-        Injection<double> dy;
-    };
 
-    struct __Point : public Injection<Point> {
-        using Injection<Point>::operator =;
-        Injection<double> distance;
-        Injection<double> time;
-        Injection<double> value;
-    };
+    /**
+     * Returns the key of the owner entry of the given part in the injection registry
+     * @param owner The part of the agent model
+     * @return The key
+     */
+    inline const void *injectionKey(InjectionOwner owner) {
 
-    struct __Dimensions : public Injection<Dimensions> {
-        using Injection<Dimensions>::operator =;
-        Injection<double> width;
-        Injection<double> length;
-    };
+        static const char keys[NUMBER_OF_INJECTION_OWNERS]{};
+        return &keys[owner];
 
-    struct __VehicleState : public Injection<VehicleState> {
-        using Injection<VehicleState>::operator =;
-        Injection<double> v;
-        Injection<double> a;
-        Injection<double> psi;
-        Injection<double> dPsi;
-        Injection<double> s;
-        Injection<double> d;
-        Injection<double> pedal;
-        Injection<double> steering;
-    };
+    }
 
-    struct __Horizon : public Injection<Horizon> {
-        using Injection<Horizon>::operator =;
-        Injection<double> ds[NOH];
-        Injection<double> x[NOH];
-        Injection<double> y[NOH];
-        Injection<double> psi[NOH];
-        Injection<double> kappa[NOH];
-        Injection<double> egoLaneWidth[NOH];
-        Injection<double> rightLaneOffset[NOH];
-        Injection<double> leftLaneOffset[NOH];
-    };
 
-    struct __Lane : public Injection<Lane> {
-        using Injection<Lane>::operator =;
-        Injection<int> id;
-        Injection<double> width;
-        Injection<double> route;
-        Injection<double> closed;
-        Injection<DrivingDirection> dir;
-        Injection<Accessibility> access;
-    };
+    /**
+     * @brief A precompiled injection target of an agent model instance
+     * The handle is created once from a path (see resolveInjection) and stores the owner entry, the byte offset
+     * and the type of the value. Setting a value through the handle adds a single patch to the owner, which is
+     * applied in the next step. The handle is bound to the agent model instance it was resolved for.
+     */
+    class InjectionHandle {
 
-    struct __ControlPath : public Injection<ControlPath> {
-        using Injection<ControlPath>::operator =;
-        Injection<double> offset;
-        Injection<double> factor;
-        __DynamicPosition refPoints[NORP];
-    };
+        InjectionInterface::Owner *_owner = nullptr;                  //!< The owner entry
+        std::ptrdiff_t _offset = 0;                                   //!< The byte offset relative to the owner
+        size_t _size = 0;                                             //!< The size of the value (in *bytes*)
+        reflection::FieldType _type = reflection::FIELD_STRUCT;       //!< The type of the value
 
-    struct __Signal : public Injection<Signal> {
-        using Injection<Signal>::operator =;
-        Injection<unsigned int> id;
-        Injection<double> ds;
-        Injection<SignalType> type;
-        Injection<double> value;
-    };
+    public:
 
-    struct __Target : public Injection<Target> {
-        using Injection<Target>::operator =;
-        Injection<unsigned int> id;
-        Injection<double> ds;
-        Injection<double> v;
-        Injection<double> a;
-        Injection<double> d;
-        Injection<double> psi;
-        Injection<int> lane;
-        __Position xy;
-        __Dimensions size;
-    };
+        /**
+         * Default constructor
+         */
+        InjectionHandle() = default;
 
-    struct __DecisionStopping : public Injection<DecisionStopping> {
-        using Injection<DecisionStopping>::operator =;
-        Injection<unsigned int> id;
-        Injection<double> position;
-        Injection<double> standingTime;
-    };
 
-    struct __Decisions : public Injection<Decisions> {
-        using Injection<Decisions>::operator =;
-        Injection<int> laneChange;
-        __Point lateral;
-        __DecisionStopping signal;
-        __DecisionStopping target;
-        __DecisionStopping destination;
-    };
+        /**
+         * Constructor
+         * @param owner Owner entry
+         * @param offset Byte offset relative to the owner
+         * @param size Size of the value (in *bytes*)
+         * @param type Type of the value
+         */
+        InjectionHandle(InjectionInterface::Owner *owner, std::ptrdiff_t offset, size_t size,
+                        reflection::FieldType type) : _owner(owner), _offset(offset), _size(size), _type(type) {}
 
-    struct __ConsciousVelocity : public Injection<ConsciousVelocity> {
-        using Injection<ConsciousVelocity>::operator =;
-        Injection<double> local;
-        Injection<double> prediction;
-    };
 
-    struct __ConsciousStop : public Injection<ConsciousStop> {
-        using Injection<ConsciousStop>::operator =;
-        Injection<double> ds;
-        Injection<double> dsMax;
-        Injection<bool> standing;
-    };
-
-    struct __ConsciousFollow : public Injection<ConsciousFollow> {
-        using Injection<ConsciousFollow>::operator =;
-        Injection<double> distance;
-        Injection<double> velocity;
-        Injection<bool> standing;
-    };
-
-    struct __ConsciousLateral : public Injection<ConsciousLateral> {
-        using Injection<ConsciousLateral>::operator =;
-        __ControlPath paths[NOCP];
-    };
-
-    struct __Conscious : public Injection<Conscious> {
-        using Injection<Conscious>::operator =;
-        __ConsciousVelocity velocity;
-        __ConsciousStop stop;
-        __ConsciousFollow follow;
-        __ConsciousLateral lateral;
-    };
+        /**
+         * Injects the value for the next step
+         * @param value The value to be injected
+         */
+        template<typename T>
+        void set(const T &value) {
 
-    struct __Subconscious : public Injection<Subconscious> {
-        using Injection<Subconscious>::operator =;
-        Injection<double> a;
-        Injection<double> dPsi;
-        Injection<double> kappa;
-        Injection<double> pedal;
-        Injection<double> steering;
-    };
+            static_assert(std::is_trivially_copyable<T>::value, "injected values must be trivially copyable.");
 
-    struct __MemoryVehicle : public Injection<MemoryVehicle> {
-        using Injection<MemoryVehicle>::operator =;
-        Injection<double> s;
-    };
+            if (_owner == nullptr)
+                throw std::invalid_argument("injection handle is not resolved.");
 
-    struct __MemoryLateral : public Injection<MemoryLateral> {
-        using Injection<MemoryLateral>::operator =;
-        Injection<double> time;
-        Injection<double> startTime;
-        Injection<double> distance;
-        Injection<double> startDistance;
-        Injection<double> offset;
-    };
+            // check type
+            bool scalar = std::is_arithmetic<T>::value || std::is_enum<T>::value;
+            if (sizeof(T) != _size || (scalar && reflection::FieldTypeOf<T>::value != _type))
+                throw std::invalid_argument("value does not match the type of the injection target.");
 
-    struct __MemoryLaneChange : public Injection<MemoryLaneChange> {
-        using Injection<MemoryLaneChange>::operator =;
-        Injection<int> switchLane;
-        Injection<int> decision;
-        Injection<double> startTime;
-    };
+            InjectionRegistry::inject(*_owner, _offset, &value, sizeof(T));
 
-    struct __ParameterVelocityControl : public Injection<ParameterVelocityControl> {
-        using Injection<ParameterVelocityControl>::operator =;
-        Injection<double> thwMax;
-        Injection<double> delta;
-        Injection<double> deltaPred;
-        Injection<double> a;
-        Injection<double> b;
-        Injection<double> vScale;
-        Injection<double> ayMax;
-        Injection<double> vComfort;
-    };
-
-    struct __ParameterFollowing : public Injection<ParameterFollowing> {
-        using Injection<ParameterFollowing>::operator =;
-        Injection<double> timeHeadway;
-        Injection<double> dsStopped;
-        Injection<double> thwMax;
-    };
-
-    struct __ParameterVehicle : public Injection<ParameterVehicle> {
-        using Injection<ParameterVehicle>::operator =;
-        __Dimensions size;
-        __Position pos;
-    };
-
-    struct __ParameterSteering : public Injection<ParameterSteering> {
-        using Injection<ParameterSteering>::operator =;
-        Injection<double> thw[NORP];
-        Injection<double> dsMin[NORP];
-        Injection<double> P[NORP];
-        Injection<double> D[NORP];
-    };
-
-    struct __ParameterStopping : public Injection<ParameterStopping> {
-        using Injection<ParameterStopping>::operator =;
-        Injection<double> dsGap;
-        Injection<double> TMax;
-        Injection<double> dsMax;
-        Injection<double> T;
-        Injection<double> tSign;
-        Injection<double> vStopped;
-        Injection<double> pedalDuringStanding;
-    };
+        }
 
-    struct __ParameterLaneChange : public Injection<ParameterLaneChange> {
-        using Injection<ParameterLaneChange>::operator =;
-        Injection<double> bSafe;
-        Injection<double> aThreshold;
-        Injection<double> politenessFactor;
-        Injection<double> time;
-    };
 
-    struct __Input : public Injection<Input> {
-        using Injection<Input>::operator =;
-        __VehicleState vehicle;
-        __Horizon horizon;
-        __Signal signals[NOS];
-        __Lane lanes[NOL];
-        __Target targets[NOT];
-    };
+        /**
+         * Returns the size of the injection target
+         * @return Size (in *bytes*)
+         */
+        size_t size() const { return _size; }
 
-    struct __State : public Injection<State> {
-        using Injection<State>::operator =;
-        Injection<double> simulationTime;
-        Injection<double> aux[NOA];
-        __Decisions decisions;
-        __Conscious conscious;
-        __Subconscious subconscious;
-    };
 
-    struct __Memory : public Injection<Memory> {
-        using Injection<Memory>::operator =;
-        Injection<double> velocity;
-        __MemoryVehicle vehicle;
-        __MemoryLateral lateral;
-        __MemoryLaneChange laneChange;
-    };
+        /**
+         * Returns the type of the injection target
+         * @return Type
+         */
+        reflection::FieldType type() const { return _type; }
 
-    struct __Parameters : public Injection<Parameters> {
-        using Injection<Parameters>::operator =;
-        __ParameterVehicle vehicle;
-        __ParameterLaneChange laneChange;
-        __ParameterStopping stop;
-        __ParameterVelocityControl velocity;
-        __ParameterFollowing follow;
-        __ParameterSteering steering;
     };
 
 
-    void registerTree(__Position *tree, Position *data, const void *owner);
-    void registerTree(__DynamicPosition *tree, DynamicPosition *data, const void *owner);
-    void registerTree(__Point *tree, Point *data, const void *owner);
-    void registerTree(__Dimensions *tree, Dimensions *data, const void *owner);
-    void registerTree(__VehicleState *tree, VehicleState *data, const void *owner);
-    void registerTree(__Horizon *tree, Horizon *data, const void *owner);
-    void registerTree(__Lane *tree, Lane *data, const void *owner);
-    void registerTree(__ControlPath *tree, ControlPath *data, const void *owner);
-    void registerTree(__Signal *tree, Signal *data, const void *owner);
-    void registerTree(__Target *tree, Target *data, const void *owner);
-    void registerTree(__DecisionStopping *tree, DecisionStopping *data, const void *owner);
-    void registerTree(__Decisions *tree, Decisions *data, const void *owner);
-    void registerTree(__ConsciousVelocity *tree, ConsciousVelocity *data, const void *owner);
-    void registerTree(__ConsciousStop *tree, ConsciousStop *data, const void *owner);
-    void registerTree(__ConsciousFollow *tree, ConsciousFollow *data, const void *owner);
-    void registerTree(__ConsciousLateral *tree, ConsciousLateral *data, const void *owner);
-    void registerTree(__Conscious *tree, Conscious *data, const void *owner);
-    void registerTree(__Subconscious *tree, Subconscious *data, const void *owner);
-    void registerTree(__MemoryVehicle *tree, MemoryVehicle *data, const void *owner);
-    void registerTree(__MemoryLateral *tree, MemoryLateral *data, const void *owner);
-    void registerTree(__MemoryLaneChange *tree, MemoryLaneChange *data, const void *owner);
-    void registerTree(__ParameterVelocityControl *tree, ParameterVelocityControl *data, const void *owner);
-    void registerTree(__ParameterFollowing *tree, ParameterFollowing *data, const void *owner);
-    void registerTree(__ParameterVehicle *tree, ParameterVehicle *data, const void *owner);
-    void registerTree(__ParameterSteering *tree, ParameterSteering *data, const void *owner);
-    void registerTree(__ParameterStopping *tree, ParameterStopping *data, const void *owner);
-    void registerTree(__ParameterLaneChange *tree, ParameterLaneChange *data, const void *owner);
-    void registerTree(__Input *tree, Input *data, const void *owner);
-    void registerTree(__State *tree, State *data, const void *owner);
-    void registerTree(__Memory *tree, Memory *data, const void *owner);
-    void registerTree(__Parameters *tree, Parameters *data, const void *owner);
-
-
-    template<typename T, typename D>
-    void registerStructArray(T *pointer, D *data, const void *owner, std::vector<unsigned long> sizes, unsigned long j = 0) {
-
-        // last iteration
-        if(j == sizes.size() - 1) {
-
-            // iterate over j-th size
-            for(unsigned long i = 0; i < sizes[j]; ++i) {
-                registerTree(pointer, data, owner);
-                pointer++; data++;
-            }
-
-            return;
-
-        }
-
-        // calculate step size
-        unsigned long steps = 1;
-        for(unsigned long i = j + 1; i < sizes.size(); ++i)
-            steps *= sizes[i];
-
-        // iterate over j-th size
-        for(unsigned long i = 0; i < sizes[j]; ++i) {
-            registerStructArray(pointer, data, owner, sizes, j + 1);
-            pointer += steps;
-            data += steps;
-        }
-
-    }
-
-    template<typename T, typename D>
-    void registerArray(T *pointer, D *data, const void *owner, std::vector<unsigned long> sizes, unsigned long j = 0) {
+    /**
+     * Resolves a path to an injection handle of the given agent model. The path starts with "input", "memory",
+     * "parameters", "state.decisions", "state.conscious" or "state.subconscious", which defines when the value
+     * is applied during the step, e.g. "input.targets[3].v" or "state.conscious.velocity.local".
+     * @param agent The agent model
+     * @param path The path to the value
+     * @return The injection handle
+     */
+    InjectionHandle resolveInjection(AgentModel &agent, const std::string &path);
 
-        // last iteration
-        if(j == sizes.size() - 1) {
 
-            // iterate over j-th size
-            for(unsigned long i = 0; i < sizes[j]; ++i) {
-                pointer->registerValue(data, owner);
-                pointer++; data++;
-            }
+    /**
+     * Returns the base address of a part of the given agent model and checks that a value lies within this part
+     * @param agent The agent model
+     * @param owner The part of the agent model
+     * @param value Address of the value
+     * @param size Size of the value (in *bytes*)
+     * @return The base address of the part
+     */
+    const void *injectionBase(AgentModel &agent, InjectionOwner owner, const void *value, size_t size);
 
-            return;
 
-        }
-
-        // calculate step size
-        unsigned long steps = 1;
-        for(unsigned long i = j + 1; i < sizes.size(); ++i)
-            steps *= sizes[i];
+    /**
+     * Registers an injection of a value of the given agent model. The value is registered with the key of the part
+     * and its offset relative to the part, so the injected value is applied in the step even if the input or state
+     * buffers are rebound (@see Interface::bind()).
+     * @param injection The injection
+     * @param value Pointer to the value (a member of the part of the agent model)
+     * @param owner The part of the agent model, which contains the value
+     * @param agent The agent model
+     */
+    template<typename T>
+    void registerInjection(Injection<T> &injection, T *value, InjectionOwner owner, AgentModel &agent) {
 
-        // iterate over j-th size
-        for(unsigned long i = 0; i < sizes[j]; ++i) {
-            registerArray(pointer, data, owner, sizes, j + 1);
-            pointer += steps;
-            data += steps;
-        }
+        auto base = injectionBase(agent, owner, value, sizeof(T));
+        injection.registerValue(value, injectionKey(owner), base, *agent.getInjectionRegistry());
 
     }
 
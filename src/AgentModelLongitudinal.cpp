@@ -0,0 +1,109 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// AgentModelLongitudinal.cpp
+
+#include <cmath>
+#include <algorithm>
+
+#include "AgentModelLongitudinal.h"
+#include "LongitudinalStages.h"
+
+
+void AgentModelLongitudinal::init() {
+
+    // unset distance counter
+    _memory.vehicle.s = 0.0;
+
+    // unset velocity
+    _memory.velocity = INFINITY;
+
+    // init horizon
+    _stop_horizon.init(_input.vehicle.s);
+    _vel_horizon.init(_input.vehicle.s, 401);
+    _filter.init(10);
+
+    // init road priorities
+    _state.conscious.stop.priority = false;
+    _state.conscious.stop.give_way = false;
+
+}
+
+
+void AgentModelLongitudinal::step(double simulationTime) {
+
+    using namespace agent_model;
+
+    // update internal horizons
+    _stop_horizon.update(_input.vehicle.s, simulationTime);
+    _vel_horizon.update(_input.vehicle.s);
+
+    // set time
+    _state.simulationTime = simulationTime;
+
+    // classify targets, either of the input or of the bound span
+    if (_targets)
+        _target_summary.update(_targets, _num_targets);
+    else
+        _target_summary.update(_input.targets, count(_input.countsValid, _input.numTargets, NOT));
+
+    // build signal lookup table
+    _signal_table.update(_input.signals, count(_input.countsValid, _input.numSignals, NOS));
+
+    // decisions
+    decisionProcessStop(_input, _state, &_input.lane, _param, _signal_table, _target_summary);
+
+    // conscious calculation (no lane change in progress)
+    consciousVelocity(_input, _state, _memory, _param, _vel_horizon, _signal_table);
+    consciousStop(_input, _state, _param, _stop_horizon);
+    consciousFollow(_input, _state, _param, _target_summary, 0, 0.0);
+
+    // calculate speed, stop and follow reactions
+    double speed = subconsciousSpeed(_input, _state, _filter);
+    double stop = subconsciousStop(_input, _state, _param);
+    double follow = subconsciousFollow(_input, _state, _param);
+
+    // calculate resulting acceleration
+    double aRes = _param.velocity.a * (1.0 - speed - stop - follow);
+
+    // set desired values
+    _state.subconscious.a     = std::min(std::max(-10.0, aRes), 10.0);
+    _state.subconscious.kappa = 0.0;
+    _state.subconscious.pedal = subconsciousStartStop(_state, _param);
+    _state.subconscious.steering = INFINITY;
+
+    // save values to memory
+    _memory.vehicle.s = _input.vehicle.s;
+
+}
+
+
+void AgentModelLongitudinal::bindTargets(const agent_model::Target *targets, unsigned int n) {
+
+    _targets = targets;
+    _num_targets = targets ? n : 0;
+
+    // no allocation during the steps
+    _target_summary.reserve(_num_targets);
+
+}
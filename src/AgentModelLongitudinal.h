@@ -0,0 +1,189 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// AgentModelLongitudinal.h
+
+#ifndef AGENT_MODEL_LONGITUDINAL_H
+#define AGENT_MODEL_LONGITUDINAL_H
+
+#include "Interface.h"
+#include "VelocityHorizon.h"
+#include "StopHorizon.h"
+#include "Filter.h"
+#include "TargetSummary.h"
+#include "InputTables.h"
+
+namespace agent_model {
+
+    /*!< A class to store the horizon of the longitudinal model (without the x, y, psi and lane channels). */
+    struct LongitudinalHorizon {
+        double ds[NOH]; //!< Distance to the horizon point along s measured from the origin of the ego coordinate system. (in *m*)
+        double kappa[NOH]; //!< curvature of the road (in *1/m*)
+        double destinationPoint; //!<  s coordinate of destination point (in *m*) -1 if not set
+    };
+
+    /*!< A class to store the inputs of the longitudinal model. */
+    struct LongitudinalInput {
+        VehicleState vehicle; //!< The vehicle state.
+        LongitudinalHorizon horizon; //!< The horizon.
+        Signal signals[NOS]; //!< The signals.
+        Lane lane; //!< The ego lane (route and lane_change define the stop at the end of the route).
+        Target targets[NOT]; //!< The targets.
+        unsigned int numSignals; //!< Number of set signals at the front of the array (only used if countsValid is set)
+        unsigned int numTargets; //!< Number of set targets at the front of the array (only used if countsValid is set)
+        unsigned int numHorizon; //!< Number of set horizon points at the front of the arrays (only used if countsValid is set)
+        bool countsValid; //!< Flag whether the counts are valid (true: only the counted elements are scanned, 0 means none; false: all elements are scanned)
+    };
+
+    /*!< A class to store the stop decisions of the longitudinal model. */
+    struct LongitudinalDecisions {
+        DecisionStopping signal; //!< The decision information caused by a signal.
+        DecisionStopping target; //!< The decision information caused by a target.
+        DecisionStopping destination; //!< The decision information caused by a destination.
+        DecisionStopping lane; //!< The decision information caused by the end of the route.
+    };
+
+    /*!< A class to store the conscious states of the longitudinal model. */
+    struct LongitudinalConscious {
+        ConsciousVelocity velocity; //!< A class to store the internal state for the conscious/velocity component.
+        ConsciousStop stop; //!< A class to store the internal state for the conscious/stop component.
+        ConsciousFollow follow; //!< A class to store the internal state for the conscious/follow component.
+    };
+
+    /*!< A class to store all internal states of the longitudinal model. */
+    struct LongitudinalState {
+        double simulationTime; //!< The actual simulation time
+        LongitudinalDecisions decisions; //!< Decision states.
+        LongitudinalConscious conscious; //!< Conscious states.
+        Subconscious subconscious; //!< Subconscious states (a and pedal are set, kappa is zero).
+    };
+
+    /*!< A class to store all memory states of the longitudinal model. */
+    struct LongitudinalMemory {
+        MemoryVehicle vehicle; //!< The memory for vehicle states.
+        double velocity; //!< The local maximum velocity.  (in *m/s*)
+    };
+
+} // namespace agent_model
+
+
+/**
+ * @brief A compact agent model for car-following studies on a single lane
+ * The model runs the stop decision, the conscious velocity, stop and follow stages and the subconscious speed, stop,
+ * follow and pedal reactions of AgentModel (@see LongitudinalStages.h). The lateral and lane change stages and their
+ * states, the lane array and the x, y and psi channels of the horizon are dropped. For the same (single lane) input,
+ * the acceleration and pedal value are identical to AgentModel's.
+ */
+class AgentModelLongitudinal {
+
+public:
+
+    typedef agent_model::LongitudinalInput Input;
+    typedef agent_model::LongitudinalState State;
+    typedef agent_model::LongitudinalMemory Memory;
+    typedef agent_model::Parameters Parameters;
+
+
+protected:
+
+    Input _input{};                                                   //!< attribute to store the input
+    State _state{};                                                   //!< attribute to store the state
+    Memory _memory{};                                                 //!< attribute to store the memory
+    Parameters _param{};                                              //!< attribute to store the parameters
+
+    agent_model::StopHorizon _stop_horizon{};                         //!< attribute to store the stop points
+    agent_model::VelocityHorizon _vel_horizon{};                      //!< attribute to store the velocity horizon
+    agent_model::Filter _filter{};                                    //!< attribute to store the speed reaction filter
+    agent_model::TargetSummary _target_summary{};                     //!< attribute to store the classified targets of the step
+    agent_model::SignalTable _signal_table{};                         //!< attribute to store the signals of the step by type
+
+    const agent_model::Target *_targets = nullptr;                    //!< attribute to store the bound target span (nullptr: input)
+    unsigned int _num_targets = 0;                                    //!< attribute to store the size of the bound target span
+
+
+public:
+
+
+    /**
+     * Initializes the driver model. Shall be ran before the the first step is executed.
+     */
+    void init();
+
+
+    /**
+     * Performs a driver model step.
+     * The driver model must be initializes (@see init()).
+     * @param simulationTime The current simulation time
+     */
+    void step(double simulationTime);
+
+
+    /**
+     * Binds the targets to a caller-provided span, which replaces Input::targets (and Input::numTargets) in the
+     * following steps (@see AgentModel::bindTargets())
+     * @param targets The targets (must outlive the binding, nullptr: use the input again)
+     * @param n The number of targets
+     */
+    void bindTargets(const agent_model::Target *targets, unsigned int n);
+
+
+    /**
+    * Returns the pointer for the _input structure of the model
+    * @return The _input point
+    */
+    Input *getInput() {
+        return &_input;
+    }
+
+
+    /**
+    * Returns the pointer for the _state structure of the model
+    * @return The _state point
+    */
+    const State *getState() const {
+        return &_state;
+    }
+
+
+    /**
+    * Returns the pointer for the _memory structure of the model
+    * @return The _memory point
+    */
+    Memory *getMemory() {
+        return &_memory;
+    }
+
+
+    /**
+    * Returns the pointer for the _param structure of the model
+    * @return The _param point
+    */
+    Parameters *getParameters() {
+        return &_param;
+    }
+
+
+};
+
+
+#endif // AGENT_MODEL_LONGITUDINAL_H
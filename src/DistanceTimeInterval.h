@@ -27,26 +27,32 @@
 #define SIMDRIVER_DISTANCETIMEINTERVAL_H
 
 #include "model_collection.h"
+#include "Snapshot.h"
 #include <cmath>
 
 
 namespace agent_model {
 
-    class DistanceTimeInterval {
+    /**
+     * @brief A class to calculate a normalized factor over a distance or time interval
+     * @tparam T The scalar type of the positions, times and factors
+     */
+    template<typename T>
+    class BasicDistanceTimeInterval {
 
     protected:
 
-        double _actualPosition = 0.0; //!< The actual position
-        double _actualTime = 0.0;     //!< The actual time
+        T _actualPosition = 0.0; //!< The actual position
+        T _actualTime = 0.0;     //!< The actual time
 
-        double _startTime = INFINITY; //!< The start time
-        double _endTime = INFINITY;   //!< The end time
+        T _startTime = INFINITY; //!< The start time
+        T _endTime = INFINITY;   //!< The end time
 
-        double _startPosition = INFINITY; //!< The start position
-        double _endPosition = INFINITY;   //!< The end position
+        T _startPosition = INFINITY; //!< The start position
+        T _endPosition = INFINITY;   //!< The end position
 
-        double _scale = 1.0; //!< The factor to be scaled
-        double _delta = 1.0; //!< The power to calculate the scale
+        T _scale = 1.0; //!< The factor to be scaled
+        T _delta = 1.0; //!< The power to calculate the scale
 
 
     public:
@@ -56,7 +62,7 @@ namespace agent_model {
          * Sets the power of the scale
          * @param delta Power of the scale
          */
-        void setDelta(double delta) {
+        void setDelta(T delta) {
 
             _delta = delta;
 
@@ -69,7 +75,8 @@ namespace agent_model {
          */
         bool isSet() const {
 
-            return !std::isinf(_startTime) || !std::isinf(_startPosition);
+            using namespace std;
+            return !isinf(_startTime) || !isinf(_startPosition);
 
         }
 
@@ -78,7 +85,7 @@ namespace agent_model {
          * Sets the scale for the factor
          * @param scale Scale
          */
-        void setScale(double scale) {
+        void setScale(T scale) {
 
             _scale = scale;
 
@@ -89,7 +96,7 @@ namespace agent_model {
          * Returns the scale parameter
          * @return The scale parameter
          */
-        double getScale() const {
+        T getScale() const {
 
             return _scale;
 
@@ -101,7 +108,7 @@ namespace agent_model {
          * @param position Actual position
          * @param time Actual time
          */
-        void update(double position, double time) {
+        void update(T position, T time) {
 
             _actualPosition = position;
             _actualTime = time;
@@ -113,9 +120,10 @@ namespace agent_model {
          * Sets the desired time interval
          * @param timeInterval Time interval
          */
-        void setTimeInterval(double timeInterval) {
+        void setTimeInterval(T timeInterval) {
 
-            if(std::isinf(timeInterval)) {
+            using namespace std;
+            if(isinf(timeInterval)) {
 
                 // set start and end time to inf
                 _startTime = INFINITY;
@@ -135,9 +143,10 @@ namespace agent_model {
          * Sets the desired end position of the interval
          * @param endPosition End position of the interval
          */
-        void setEndPosition(double endPosition) {
+        void setEndPosition(T endPosition) {
 
-            if(std::isinf(endPosition)) {
+            using namespace std;
+            if(isinf(endPosition)) {
 
                 // set start and end time to inf
                 _startPosition = INFINITY;
@@ -169,7 +178,9 @@ namespace agent_model {
          * Returns the normalized factor
          * @return The normalized factor
          */
-        double getFactor() const {
+        T getFactor() const {
+
+            using namespace std;
 
             // if not set, return 0
             if(!isSet())
@@ -179,8 +190,8 @@ namespace agent_model {
 //            double ft = std::isinf(_startTime) ? 0.0 : agent_model::scale(_actualTime, _endTime, _startTime, 0.5);
 //            double fs = std::isinf(_startPosition) ? 0.0 : agent_model::scale(_actualPosition, _endPosition, _startPosition, 0.5);
 
-            double ft = std::isinf(_startTime) ? 0.0 : agent_model::scale(_actualTime, _endTime, _startTime, _delta);
-            double fs = std::isinf(_startPosition) ? 0.0 : agent_model::scale(_actualPosition, _endPosition, _startPosition, _delta);
+            T ft = isinf(_startTime) ? T(0.0) : agent_model::scale(_actualTime, _endTime, _startTime, _delta);
+            T fs = isinf(_startPosition) ? T(0.0) : agent_model::scale(_actualPosition, _endPosition, _startPosition, _delta);
 
             // maximum
             return (std::max)(ft, fs);
@@ -192,14 +203,65 @@ namespace agent_model {
          * Returns the scaled factor of the interval
          * @return The scaled factor
          */
-        double getScaledFactor() const {
+        T getScaledFactor() const {
 
             return getFactor() * _scale;
 
         }
 
+
+        /**
+         * Returns the number of bytes needed to store the interval in a snapshot
+         * @return Number of bytes
+         */
+        size_t snapshotSize() const {
+
+            return 8 * sizeof(T);
+
+        }
+
+
+        /**
+         * Writes the interval to the snapshot buffer
+         * @param buffer Buffer to be written to
+         * @return Pointer behind the written data
+         */
+        char *save(char *buffer) const {
+
+            buffer = snapshot::write(buffer, _actualPosition);
+            buffer = snapshot::write(buffer, _actualTime);
+            buffer = snapshot::write(buffer, _startTime);
+            buffer = snapshot::write(buffer, _endTime);
+            buffer = snapshot::write(buffer, _startPosition);
+            buffer = snapshot::write(buffer, _endPosition);
+            buffer = snapshot::write(buffer, _scale);
+            return snapshot::write(buffer, _delta);
+
+        }
+
+
+        /**
+         * Restores the interval from the snapshot buffer
+         * @param buffer Buffer to be read from
+         * @return Pointer behind the read data
+         */
+        const char *restore(const char *buffer) {
+
+            buffer = snapshot::read(buffer, _actualPosition);
+            buffer = snapshot::read(buffer, _actualTime);
+            buffer = snapshot::read(buffer, _startTime);
+            buffer = snapshot::read(buffer, _endTime);
+            buffer = snapshot::read(buffer, _startPosition);
+            buffer = snapshot::read(buffer, _endPosition);
+            buffer = snapshot::read(buffer, _scale);
+            return snapshot::read(buffer, _delta);
+
+        }
+
     };
 
+    typedef BasicDistanceTimeInterval<double> DistanceTimeInterval; //!< The interval with double values
+
 } // namespace
 
 #endif //SIMDRIVER_DISTANCETIMEINTERVAL_H
@@ -0,0 +1,222 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// Dual.h
+
+
+#ifndef SIMDRIVER_DUAL_H
+#define SIMDRIVER_DUAL_H
+
+#include <cmath>
+
+namespace agent_model {
+
+    namespace dual {
+
+        /**
+         * @brief A forward-mode dual number with N derivative directions
+         * The number stores a value and the derivatives of the value with respect to N independent variables (e.g.
+         * the parameters of a driver profile). The model kernels (@see model_collection.h) and the agent model with its
+         * horizons and stages (@see BasicAgentModel) can be evaluated with dual numbers, so a single pass gives the
+         * exact sensitivities of a complete trajectory. Branches of the model are decided by the values only.
+         * @tparam N Number of derivative directions
+         */
+        template<unsigned int N>
+        struct Dual {
+
+            double v = 0.0;   //!< The value
+            double d[N] = {}; //!< The derivatives
+
+
+            /** Default constructor */
+            Dual() = default;
+
+
+            /**
+             * Creates a constant
+             * @param value The value
+             */
+            Dual(double value) : v(value) {}
+
+
+            /**
+             * Creates an independent variable
+             * @param value The value
+             * @param i The index of the derivative direction
+             * @return The variable
+             */
+            static Dual variable(double value, unsigned int i) {
+
+                Dual r(value);
+                r.d[i] = 1.0;
+
+                return r;
+
+            }
+
+
+            /**
+             * Returns the value
+             * @return The value
+             */
+            double value() const {
+                return v;
+            }
+
+
+            /**
+             * Returns the derivative with respect to the i-th variable
+             * @param i Index of the derivative direction
+             * @return The derivative
+             */
+            double derivative(unsigned int i) const {
+                return d[i];
+            }
+
+
+            /**
+             * Returns the value (the derivatives are dropped, e.g. to calculate an index)
+             * @return The value
+             */
+            explicit operator double() const {
+                return v;
+            }
+
+
+            // arithmetic operators
+
+            friend Dual operator-(const Dual &a) {
+                Dual r(-a.v);
+                for (unsigned int i = 0; i < N; ++i) r.d[i] = -a.d[i];
+                return r;
+            }
+
+            friend Dual operator+(const Dual &a, const Dual &b) {
+                Dual r(a.v + b.v);
+                for (unsigned int i = 0; i < N; ++i) r.d[i] = a.d[i] + b.d[i];
+                return r;
+            }
+
+            friend Dual operator-(const Dual &a, const Dual &b) {
+                Dual r(a.v - b.v);
+                for (unsigned int i = 0; i < N; ++i) r.d[i] = a.d[i] - b.d[i];
+                return r;
+            }
+
+            friend Dual operator*(const Dual &a, const Dual &b) {
+                Dual r(a.v * b.v);
+                for (unsigned int i = 0; i < N; ++i) r.d[i] = a.d[i] * b.v + a.v * b.d[i];
+                return r;
+            }
+
+            friend Dual operator/(const Dual &a, const Dual &b) {
+                Dual r(a.v / b.v);
+                for (unsigned int i = 0; i < N; ++i) r.d[i] = (a.d[i] * b.v - a.v * b.d[i]) / (b.v * b.v);
+                return r;
+            }
+
+            Dual &operator+=(const Dual &b) { return *this = *this + b; }
+            Dual &operator-=(const Dual &b) { return *this = *this - b; }
+            Dual &operator*=(const Dual &b) { return *this = *this * b; }
+            Dual &operator/=(const Dual &b) { return *this = *this / b; }
+
+
+            // comparison operators (compare the values only)
+
+            friend bool operator<(const Dual &a, const Dual &b) { return a.v < b.v; }
+            friend bool operator<=(const Dual &a, const Dual &b) { return a.v <= b.v; }
+            friend bool operator>(const Dual &a, const Dual &b) { return a.v > b.v; }
+            friend bool operator>=(const Dual &a, const Dual &b) { return a.v >= b.v; }
+            friend bool operator==(const Dual &a, const Dual &b) { return a.v == b.v; }
+            friend bool operator!=(const Dual &a, const Dual &b) { return a.v != b.v; }
+
+
+            // functions (found by argument dependent lookup)
+
+            friend bool isinf(const Dual &a) { return std::isinf(a.v); }
+            friend bool isnan(const Dual &a) { return std::isnan(a.v); }
+            friend bool isfinite(const Dual &a) { return std::isfinite(a.v); }
+
+            friend Dual abs(const Dual &a) {
+                return a.v < 0.0 ? -a : a;
+            }
+
+            friend Dual sqrt(const Dual &a) {
+                Dual r(std::sqrt(a.v));
+                for (unsigned int i = 0; i < N; ++i) r.d[i] = a.d[i] / (2.0 * r.v);
+                return r;
+            }
+
+            friend Dual pow(const Dual &a, const Dual &b) {
+
+                Dual r(std::pow(a.v, b.v));
+
+                // derivative of the base (well defined for a = 0 as well)
+                double da = b.v * std::pow(a.v, b.v - 1.0);
+
+                for (unsigned int i = 0; i < N; ++i) {
+                    r.d[i] = a.d[i] == 0.0 ? 0.0 : da * a.d[i];
+                    if (b.d[i] != 0.0) r.d[i] += b.d[i] * std::log(a.v) * r.v;
+                }
+
+                return r;
+
+            }
+
+            friend Dual atan2(const Dual &y, const Dual &x) {
+                Dual r(std::atan2(y.v, x.v));
+                double n = x.v * x.v + y.v * y.v;
+                for (unsigned int i = 0; i < N; ++i) r.d[i] = (x.v * y.d[i] - y.v * x.d[i]) / n;
+                return r;
+            }
+
+            friend Dual sin(const Dual &a) {
+                Dual r(std::sin(a.v));
+                double c = std::cos(a.v);
+                for (unsigned int i = 0; i < N; ++i) r.d[i] = c * a.d[i];
+                return r;
+            }
+
+            friend Dual cos(const Dual &a) {
+                Dual r(std::cos(a.v));
+                double s = -std::sin(a.v);
+                for (unsigned int i = 0; i < N; ++i) r.d[i] = s * a.d[i];
+                return r;
+            }
+
+            friend Dual atan(const Dual &a) {
+                Dual r(std::atan(a.v));
+                double f = 1.0 / (1.0 + a.v * a.v);
+                for (unsigned int i = 0; i < N; ++i) r.d[i] = f * a.d[i];
+                return r;
+            }
+
+        };
+
+    }
+
+    using dual::Dual;
+
+}
+
+#endif // SIMDRIVER_DUAL_H
@@ -26,23 +26,31 @@
 #ifndef SIMDRIVER_FILTER_H
 #define SIMDRIVER_FILTER_H
 
-#include <deque>
-#include <vector>
+#include <stdexcept>
+#include "Snapshot.h"
 
 namespace agent_model {
 
 
     /**
      * @brief A class to implement a mean filter
+     * The elements are stored in a fixed-size array, so the filter can be copied without allocating memory.
+     * @tparam T The scalar type of the elements
      */
-    class Filter {
+    template<typename T>
+    class BasicFilter {
+
+    public:
+
+        static const unsigned int MAX_LENGTH = 100; //!< Maximum length of the filter
 
     protected:
 
-        unsigned int n; //!< Number of elements
-        unsigned int i; //!< Current element's index (circular buffer)
+        unsigned int n = 0; //!< Number of elements
+        unsigned int i = 0; //!< Current element's index (circular buffer)
+        unsigned int _size = 0; //!< Number of stored elements
 
-        std::vector<double> _elements; //!< Element container
+        T _elements[MAX_LENGTH]{}; //!< Element container
 
     public:
 
@@ -53,16 +61,18 @@ namespace agent_model {
          */
         void init(unsigned int length) {
 
+            // check length
+            if (length == 0 || length > MAX_LENGTH)
+                throw std::invalid_argument("filter length must be positive and not exceed the maximum length.");
+
+            // reset elements
+            if (_size != length)
+                _size = 0;
+
             // set length and index
             n = length;
             i = 0;
 
-            // create vector
-            if (_elements.size() != n) {
-                _elements.clear();
-                _elements.reserve(n);
-            }
-
         }
 
 
@@ -70,19 +80,19 @@ namespace agent_model {
          * Returns the filtered mean value of the elements
          * @return Filtered mean value
          */
-        double value() {
+        T value() const {
 
             // special case
-            if(_elements.empty())
+            if(_size == 0)
                 return 0.0;
 
             // sum up
-            auto sum = 0.0;
-            for (auto &e : _elements)
-                sum += e;
+            T sum = 0.0;
+            for (unsigned int j = 0; j < _size; ++j)
+                sum += _elements[j];
 
             // return average value
-            return sum / (double) _elements.size();
+            return sum / (double) _size;
 
         }
 
@@ -92,13 +102,13 @@ namespace agent_model {
          * @param v Value to be added
          * @return The mean value
          */
-        double value(double v) {
+        T value(T v) {
 
             // add element
-            if(_elements.size() < n)
-                _elements.emplace_back(v);
+            if(_size < n)
+                _elements[_size++] = v;
             else
-                _elements.at(i) = v;
+                _elements[i] = v;
 
             // increment i
             i = (i + 1) % n;
@@ -108,8 +118,84 @@ namespace agent_model {
 
         }
 
+
+        /**
+         * Returns the number of bytes needed to store the filter in a snapshot
+         * @return Number of bytes
+         */
+        size_t snapshotSize() const {
+
+            return sizeof(n) + sizeof(i) + sizeof(_size) + _size * sizeof(T);
+
+        }
+
+
+        /**
+         * Checks the filter section of a snapshot buffer without restoring it
+         * @param buffer Buffer to be checked
+         * @param available Remaining size of the buffer (in *bytes*)
+         * @return Size of the section (in *bytes*)
+         */
+        static size_t checkSnapshot(const char *buffer, size_t available) {
+
+            unsigned int length = 0, index = 0, size = 0;
+            snapshot::require(sizeof(n) + sizeof(i) + sizeof(_size), available);
+            snapshot::read(snapshot::read(snapshot::read(buffer, length), index), size);
+
+            // check size (an empty filter would divide by zero in value())
+            if (length == 0 || length > MAX_LENGTH || index >= length || size > length)
+                throw std::invalid_argument("snapshot buffer is invalid.");
+
+            auto total = sizeof(n) + sizeof(i) + sizeof(_size) + size * sizeof(T);
+            snapshot::require(total, available);
+            return total;
+
+        }
+
+
+        /**
+         * Writes the filter to the snapshot buffer
+         * @param buffer Buffer to be written to
+         * @return Pointer behind the written data
+         */
+        char *save(char *buffer) const {
+
+            buffer = snapshot::write(buffer, n);
+            buffer = snapshot::write(buffer, i);
+            buffer = snapshot::write(buffer, _size);
+
+            // write elements
+            std::memcpy(buffer, _elements, _size * sizeof(T));
+            return buffer + _size * sizeof(T);
+
+        }
+
+
+        /**
+         * Restores the filter from the snapshot buffer
+         * @param buffer Buffer to be read from
+         * @return Pointer behind the read data
+         */
+        const char *restore(const char *buffer) {
+
+            buffer = snapshot::read(buffer, n);
+            buffer = snapshot::read(buffer, i);
+            buffer = snapshot::read(buffer, _size);
+
+            // check size
+            if (n == 0 || n > MAX_LENGTH || i >= n || _size > n)
+                throw std::invalid_argument("snapshot buffer is invalid.");
+
+            // read elements
+            std::memcpy(_elements, buffer, _size * sizeof(T));
+            return buffer + _size * sizeof(T);
+
+        }
+
     };
 
+    typedef BasicFilter<double> Filter; //!< The mean filter for double values
+
 
 }
 
@@ -0,0 +1,116 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// ForkBatch.cpp
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include "ForkBatch.h"
+
+namespace agent_model {
+
+
+    void ForkBatch::fork(const AgentModel &agent, AgentModel *forks, unsigned int n) {
+
+        for (unsigned int k = 0; k < n; ++k)
+            forks[k] = agent;
+
+    }
+
+
+    void ForkBatch::run(const AgentModel &agent, AgentModel *forks, unsigned int n, double time, double stepSize,
+                        unsigned int steps, const InputFunction &input, unsigned int threads) {
+
+        // get number of threads
+        if (threads == 0)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+
+        threads = std::min(threads, n);
+
+        // create forks
+        fork(agent, forks, n);
+
+        // runs the forks k0, k0 + threads, k0 + 2 * threads, ...
+        auto worker = [&](unsigned int k0, std::exception_ptr &error) {
+
+            try {
+
+                for (unsigned int k = k0; k < n; k += threads) {
+
+                    for (unsigned int i = 0; i < steps; ++i) {
+
+                        double t = time + i * stepSize;
+
+                        // set inputs and step
+                        input(k, forks[k], t);
+                        forks[k].step(t);
+
+                    }
+                }
+
+            } catch (...) {
+
+                error = std::current_exception();
+
+            }
+
+        };
+
+        // run in calling thread only
+        if (threads <= 1) {
+
+            std::exception_ptr error = nullptr;
+            worker(0, error);
+
+            if (error)
+                std::rethrow_exception(error);
+
+            return;
+
+        }
+
+        // start threads
+        std::vector<std::exception_ptr> errors(threads, nullptr);
+        std::vector<std::thread> pool;
+        pool.reserve(threads);
+
+        for (unsigned int j = 0; j < threads; ++j)
+            pool.emplace_back(worker, j, std::ref(errors[j]));
+
+        // wait for threads
+        for (auto &th : pool)
+            th.join();
+
+        // forward the first error
+        for (auto &e : errors) {
+            if (e)
+                std::rethrow_exception(e);
+        }
+
+    }
+
+
+}
@@ -0,0 +1,84 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// ForkBatch.h
+
+
+#ifndef SIMDRIVER_FORKBATCH_H
+#define SIMDRIVER_FORKBATCH_H
+
+#include <functional>
+#include "AgentModel.h"
+
+namespace agent_model {
+
+
+    /**
+     * @brief A class to run forks of an agent forward in parallel
+     * A fork is a copy of the agent at the current step. Since the internal states of the agent model are stored in
+     * fixed-size containers, forking does not allocate memory. The forks can then be stepped under hypothetical
+     * inputs (e.g. a signal turning red) and discarded afterwards.
+     */
+    class ForkBatch {
+
+    public:
+
+        /**
+         * Function to be called before each step of a fork. The function shall set the (hypothetical) inputs of the
+         * fork, e.g. by integrating the vehicle state based on the previous outputs.
+         * @param k Index of the fork
+         * @param fork The fork to be updated
+         * @param time The simulation time of the upcoming step
+         */
+        typedef std::function<void(unsigned int k, AgentModel &fork, double time)> InputFunction;
+
+
+        /**
+         * Forks the agent into the given forks
+         * @param agent The agent to be forked
+         * @param forks Array of forks (at least n elements)
+         * @param n Number of forks
+         */
+        static void fork(const AgentModel &agent, AgentModel *forks, unsigned int n);
+
+
+        /**
+         * Forks the agent into the given forks and runs the forks forward in parallel
+         * @param agent The agent to be forked
+         * @param forks Array of forks (at least n elements)
+         * @param n Number of forks
+         * @param time The simulation time of the first step
+         * @param stepSize The step size (in *s*)
+         * @param steps The number of steps to be run
+         * @param input The function to set the inputs before each step
+         * @param threads Number of threads to be used (0: number of hardware threads)
+         */
+        static void run(const AgentModel &agent, AgentModel *forks, unsigned int n, double time, double stepSize,
+                        unsigned int steps, const InputFunction &input, unsigned int threads = 0);
+
+    };
+
+
+}
+
+#endif // SIMDRIVER_FORKBATCH_H
@@ -0,0 +1,314 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// InputTables.h
+
+#ifndef SIMDRIVER_INPUT_TABLES_H
+#define SIMDRIVER_INPUT_TABLES_H
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include "Interface.h"
+
+namespace agent_model {
+
+
+    /**
+     * Returns the number of elements to be scanned in an input array
+     * @param valid Flag whether the counts of the input are valid (false: all elements are scanned)
+     * @param n The element count of the input (0: no element is scanned)
+     * @param max The size of the array
+     * @return The number of elements
+     */
+    inline unsigned int count(bool valid, unsigned int n, unsigned int max) {
+        return !valid || n > max ? max : n;
+    }
+
+
+    /**
+     * Checks the element counts of the input. If the counts are valid, the set elements must be compacted to the front
+     * of the array: the targets must be set (id > 0), the signals must have a type and the horizon points must be
+     * finite and ordered by ds. Inputs without valid counts are not checked.
+     * @param input The input
+     */
+    template<typename T>
+    void validate(const BasicInput<T> &input) {
+
+        using namespace std;
+
+        if (!input.countsValid)
+            return;
+
+        if (input.numSignals > NOS || input.numLanes > NOL || input.numTargets > NOT || input.numHorizon > NOH)
+            throw std::invalid_argument("element count exceeds the size of the array.");
+
+        for (unsigned int i = 0; i < input.numTargets; ++i) {
+            if (input.targets[i].id == 0)
+                throw std::invalid_argument("targets must be compacted to the front of the array.");
+        }
+
+        for (unsigned int i = 0; i < input.numSignals; ++i) {
+            if (input.signals[i].type == SIGNAL_NOT_SET)
+                throw std::invalid_argument("signals must be compacted to the front of the array.");
+        }
+
+        auto &h = input.horizon;
+        for (unsigned int i = 0; i < input.numHorizon; ++i) {
+            if (!isfinite(h.ds[i]) || (i > 0 && !(h.ds[i] > h.ds[i - 1])))
+                throw std::invalid_argument("horizon points must be finite and ordered by ds.");
+        }
+
+    }
+
+
+    /**
+     * @brief A lookup table from lane ids to lanes, which is built once per step
+     * Ids within [-(NOL - 1), NOL - 1] are looked up directly, other ids by a scan. If an id occurs more than once, the
+     * last lane with this id is returned (as the stages did before by scanning the lanes).
+     * @tparam T The scalar type of the input
+     */
+    template<typename T>
+    class BasicLaneTable {
+
+    public:
+
+        static const int RANGE = (int) NOL - 1; //!< The range of directly mapped ids
+
+    protected:
+
+        const BasicLane<T> *_lanes = nullptr;       //!< The lanes
+        unsigned int _n = 0;                        //!< The number of lanes
+        const BasicLane<T> *_map[2 * RANGE + 1]{};  //!< The lanes by id (offset by RANGE)
+
+    public:
+
+        /**
+         * Builds the table
+         * @param lanes The lanes
+         * @param n The number of lanes
+         */
+        void update(const BasicLane<T> *lanes, unsigned int n) {
+
+            _lanes = lanes;
+            _n = n < NOL ? n : NOL;
+
+            for (auto &l : _map)
+                l = nullptr;
+
+            // later lanes overwrite earlier ones with the same id
+            for (unsigned int i = 0; i < _n; ++i) {
+                if (lanes[i].id >= -RANGE && lanes[i].id <= RANGE)
+                    _map[lanes[i].id + RANGE] = &lanes[i];
+            }
+
+        }
+
+
+        /**
+         * Returns the (last) lane with the given id
+         * @param id The id of the lane relative to the ego lane
+         * @return The lane (nullptr: not found)
+         */
+        const BasicLane<T> *lane(int id) const {
+
+            if (id >= -RANGE && id <= RANGE)
+                return _map[id + RANGE];
+
+            const BasicLane<T> *lane = nullptr;
+            for (unsigned int i = 0; i < _n; ++i) {
+                if (_lanes[i].id == id)
+                    lane = &_lanes[i];
+            }
+
+            return lane;
+
+        }
+
+    };
+
+    typedef BasicLaneTable<double> LaneTable; //!< The lane table of the double input
+
+
+    /**
+     * @brief Signal lists partitioned by type, which are built once per step
+     * The traffic lights and the signs (stop, yield and priority signs in use, which are not subsignals) ahead of the
+     * vehicle (0 <= ds < inf) are sorted by ds, signals with equal distances keep their input order. Hence, the first
+     * element of each list is the nearest relevant signal. The speed limits are listed in input order, since the
+     * speed rules are chained along the route in this order.
+     * @tparam T The scalar type of the input
+     */
+    template<typename T>
+    class BasicSignalTable {
+
+    protected:
+
+        const BasicSignal<T> *_signals = nullptr;       //!< The signals
+        unsigned int _n = 0;                            //!< The number of signals
+
+        std::vector<unsigned int> _trafficLights;       //!< The traffic lights ahead (sorted by ds)
+        std::vector<unsigned int> _signs;               //!< The relevant signs ahead (sorted by ds)
+        std::vector<unsigned int> _speedLimits;         //!< The speed limits (input order)
+
+    public:
+
+        /**
+         * Default constructor. Reserves the lists for NOS signals.
+         */
+        BasicSignalTable() {
+            reserve(NOS);
+        }
+
+
+        /**
+         * Reserves the lists for the given number of signals
+         * @param n The number of signals
+         */
+        void reserve(unsigned int n) {
+
+            _trafficLights.reserve(n);
+            _signs.reserve(n);
+            _speedLimits.reserve(n);
+
+        }
+
+
+        /**
+         * Builds the lists
+         * @param signals The signals
+         * @param n The number of signals
+         */
+        void update(const BasicSignal<T> *signals, unsigned int n) {
+
+            _signals = signals;
+            _n = n;
+            _trafficLights.clear();
+            _signs.clear();
+            _speedLimits.clear();
+
+            for (unsigned int i = 0; i < n; ++i) {
+
+                auto &e = signals[i];
+                bool ahead = e.ds >= 0 && e.ds < INFINITY;
+
+                if (e.type == SIGNAL_SPEED_LIMIT)
+                    _speedLimits.push_back(i);
+                else if (e.type == SIGNAL_TLS && ahead)
+                    _trafficLights.push_back(i);
+                else if ((e.type == SIGNAL_YIELD || e.type == SIGNAL_PRIORITY || e.type == SIGNAL_STOP)
+                         && e.sign_is_in_use && !e.subsignal && ahead)
+                    _signs.push_back(i);
+
+            }
+
+            sort(_trafficLights);
+            sort(_signs);
+
+        }
+
+
+        /**
+         * Returns a signal
+         * @param index The index of the signal
+         * @return The signal
+         */
+        const BasicSignal<T> &signal(unsigned int index) const {
+            return _signals[index];
+        }
+
+
+        /**
+         * Returns the traffic lights ahead sorted by ds
+         * @param size The number of traffic lights
+         * @return The indices of the signals
+         */
+        const unsigned int *trafficLights(unsigned int &size) const {
+            size = (unsigned int) _trafficLights.size();
+            return _trafficLights.data();
+        }
+
+
+        /**
+         * Returns the relevant signs ahead sorted by ds
+         * @param size The number of signs
+         * @return The indices of the signals
+         */
+        const unsigned int *signs(unsigned int &size) const {
+            size = (unsigned int) _signs.size();
+            return _signs.data();
+        }
+
+
+        /**
+         * Returns the speed limits in input order
+         * @param size The number of speed limits
+         * @return The indices of the signals
+         */
+        const unsigned int *speedLimits(unsigned int &size) const {
+            size = (unsigned int) _speedLimits.size();
+            return _speedLimits.data();
+        }
+
+
+        /**
+         * Returns the nearest traffic light ahead
+         * @return The signal (nullptr: none)
+         */
+        const BasicSignal<T> *nextTrafficLight() const {
+            return _trafficLights.empty() ? nullptr : &_signals[_trafficLights[0]];
+        }
+
+
+        /**
+         * Returns the nearest relevant sign ahead
+         * @return The signal (nullptr: none)
+         */
+        const BasicSignal<T> *nextSign() const {
+            return _signs.empty() ? nullptr : &_signals[_signs[0]];
+        }
+
+
+    protected:
+
+        /**
+         * Sorts a list of signals by ds (signals with the same distance keep their input order)
+         * @param list The list
+         */
+        void sort(std::vector<unsigned int> &list) const {
+
+            auto signals = _signals;
+            std::sort(list.begin(), list.end(), [signals](unsigned int a, unsigned int b) {
+                return signals[a].ds < signals[b].ds || (signals[a].ds == signals[b].ds && a < b);
+            });
+
+        }
+
+    };
+
+    typedef BasicSignalTable<double> SignalTable; //!< The signal table of the double input
+
+
+}
+
+#endif // SIMDRIVER_INPUT_TABLES_H
@@ -27,6 +27,10 @@
 #define AGENT_MODEL_INTERFACE_H
 
 
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
 namespace agent_model {
 
     static const unsigned int NOT = 32; //!< Maximum defined number of targets.
@@ -65,77 +69,92 @@ namespace agent_model {
     enum Maneuver { STRAIGHT, TURN_LEFT, TURN_RIGHT };
 
 
+    // The structs are templates over the scalar type T of the values, so the model can also be evaluated with dual
+    // numbers (@see Dual). The names without prefix are the structs with double values, which define the ABI.
 
     /*!< A 2D position class. */
-    struct Position {
-        double x; //!< The x ordinate. (in *m*)
-        double y; //!< The y ordinate. (in *m*)
-        Position(): x(0.0), y(0.0) {}
-        Position(double pX, double pY) : x(pX), y(pY) {}
+    template<typename T>
+    struct BasicPosition {
+        T x; //!< The x ordinate. (in *m*)
+        T y; //!< The y ordinate. (in *m*)
+        BasicPosition(): x(0.0), y(0.0) {}
+        BasicPosition(T pX, T pY) : x(pX), y(pY) {}
         
-        bool operator==(const Position& other)
+        bool operator==(const BasicPosition<T>& other)
         {
             return x == other.x && y == other.y;
         }
     };
+    typedef BasicPosition<double> Position;
     
 
 
     /*!< A 2D position with motion and a influence factor. */
-    struct DynamicPosition {
-        double x; //!< The x ordinate. (in *m*)
-        double y; //!< The y ordinate. (in *m*)
-        double dx; //!< The derivative of the x component. (in *m/s*)
-        double dy; //!< The derivative of the y component. (in *m/s*)
+    template<typename T>
+    struct BasicDynamicPosition {
+        T x; //!< The x ordinate. (in *m*)
+        T y; //!< The y ordinate. (in *m*)
+        T dx; //!< The derivative of the x component. (in *m/s*)
+        T dy; //!< The derivative of the y component. (in *m/s*)
     };
+    typedef BasicDynamicPosition<double> DynamicPosition;
 
     /*!< A point class, consisting of a distance and a value. */
-    struct Point {
-        double distance; //!< The distance at which the value applies. (in *m*)
-        double time; //!< The relative time at which the value applies. (in *s*)
-        double value; //!< The value of the point.
+    template<typename T>
+    struct BasicPoint {
+        T distance; //!< The distance at which the value applies. (in *m*)
+        T time; //!< The relative time at which the value applies. (in *s*)
+        T value; //!< The value of the point.
     };
+    typedef BasicPoint<double> Point;
 
     /*!< A dimensions class, saving width and length of an object. */
-    struct Dimensions {
-        double width; //!< The width of an object. (in *m*)
-        double length; //!< The length of an object. (in *m*)
+    template<typename T>
+    struct BasicDimensions {
+        T width; //!< The width of an object. (in *m*)
+        T length; //!< The length of an object. (in *m*)
     };
+    typedef BasicDimensions<double> Dimensions;
 
     /*!< A class to save a vehicle state. */
-    struct VehicleState {
-        double v; //!< The velocity of the vehicle in x direction. (in *m/s*)
-        double a; //!< The acceleration of the vehicle in x direction. (in *m/s^2*)
-        double psi; //!< The yaw angle of the vehicle which is the angle between the vehicle x axis and heading of the current lane in mathematical positive direction. (in *rad*)
-        double dPsi; //!< The time derivative of the yaw angle (yaw rate). (in *rad/s*)
-        double s; //!< The distance, the vehicle travelled since the last reset. (in *m*)
-        double d; //!< The lateral offset of the vehicle to the current reference line of the track (e.g. lane center). (in *m*)
-        double pedal; //!< The actual pedal value [-1..1]. Negative values define a brake pedal
-        double steering; //!< The actual steering value [-1..1]. Negative values define left turns
+    template<typename T>
+    struct BasicVehicleState {
+        T v; //!< The velocity of the vehicle in x direction. (in *m/s*)
+        T a; //!< The acceleration of the vehicle in x direction. (in *m/s^2*)
+        T psi; //!< The yaw angle of the vehicle which is the angle between the vehicle x axis and heading of the current lane in mathematical positive direction. (in *rad*)
+        T dPsi; //!< The time derivative of the yaw angle (yaw rate). (in *rad/s*)
+        T s; //!< The distance, the vehicle travelled since the last reset. (in *m*)
+        T d; //!< The lateral offset of the vehicle to the current reference line of the track (e.g. lane center). (in *m*)
+        T pedal; //!< The actual pedal value [-1..1]. Negative values define a brake pedal
+        T steering; //!< The actual steering value [-1..1]. Negative values define left turns
         Maneuver maneuver; //!< The general classification of the vehicle's path during the scenario
-        double dsIntersection; //!< Distance along s to the intersection (if ego is approaching an intersection)
+        T dsIntersection; //!< Distance along s to the intersection (if ego is approaching an intersection)
 
     };
+    typedef BasicVehicleState<double> VehicleState;
 
     /*!< A class to store horizon points. */
-    struct Horizon {
-        double ds[NOH]; //!< Distance to the horizon point along s measured from the origin of the ego coordinate system. (in *m*)
-        double x[NOH]; //!< x ordinate relative to ego unit (in *m*)
-        double y[NOH]; //!< y ordinate relative to ego unit (in *m*)
-        double psi[NOH]; //!< heading relative to vehicle x-axis (in *rad*)
-        double kappa[NOH]; //!< curvature of the road (in *1/m*)
-        double egoLaneWidth[NOH]; //!< Width of ego lane (in *m*) -1 if not set
-        double rightLaneOffset[NOH]; //!< Offset to right centerlane (in *m*) 0 if not set
-        double leftLaneOffset[NOH]; //!< Offset to left centerlane (in *m*) 0 if not set
-        double destinationPoint; //!<  s coordinate of destination point (in *m*) -1 if not set
-    };
+    template<typename T>
+    struct BasicHorizon {
+        T ds[NOH]; //!< Distance to the horizon point along s measured from the origin of the ego coordinate system. (in *m*)
+        T x[NOH]; //!< x ordinate relative to ego unit (in *m*)
+        T y[NOH]; //!< y ordinate relative to ego unit (in *m*)
+        T psi[NOH]; //!< heading relative to vehicle x-axis (in *rad*)
+        T kappa[NOH]; //!< curvature of the road (in *1/m*)
+        T egoLaneWidth[NOH]; //!< Width of ego lane (in *m*) -1 if not set
+        T rightLaneOffset[NOH]; //!< Offset to right centerlane (in *m*) 0 if not set
+        T leftLaneOffset[NOH]; //!< Offset to left centerlane (in *m*) 0 if not set
+        T destinationPoint; //!<  s coordinate of destination point (in *m*) -1 if not set
+    };
+    typedef BasicHorizon<double> Horizon;
 
     /*!< A class to store lane information. */
-    struct Lane {
+    template<typename T>
+    struct BasicLane {
         int id; //!< Unique ID of the signal. The id is not just an identifier but also specifies the position of the lane relative to the ego lane in OpenDRIVE manner! e.g. -1 = the next lane to the left, 1 = the next lane to the right.
-        double width; //!< Width of the lane (in *m*) -1 if not set
-        double route; //!< Distance on the lane until the lane splits from the current route. (in *m*) -1 if not set
-        double closed; //!< Distance on the lane until the lane is closed. (in *m*) -1 if not set
+        T width; //!< Width of the lane (in *m*) -1 if not set
+        T route; //!< Distance on the lane until the lane splits from the current route. (in *m*) -1 if not set
+        T closed; //!< Distance on the lane until the lane is closed. (in *m*) -1 if not set
         DrivingDirection dir; //!< The driving direction of the lane related to the ego direction.
         Accessibility access; //!< The accessibility of the lane from the ego lane. - true if type driving
         int lane_change; //!< Flag if lane change is
@@ -144,250 +163,370 @@ namespace agent_model {
                         // intended (1) - necessary, but also later possibility
                         // required (2) - last chance
     };
+    typedef BasicLane<double> Lane;
 
     /*!< A class to store control path information */
-    struct ControlPath {
-        double offset; //!< The lateral offset from the reference line to be controlled to. (in *m*)
-        double factor; //!< A factor to describe the influence of the point
-        DynamicPosition refPoints[NORP]; //!< The reference points for the lateral control.
+    template<typename T>
+    struct BasicControlPath {
+        T offset; //!< The lateral offset from the reference line to be controlled to. (in *m*)
+        T factor; //!< A factor to describe the influence of the point
+        BasicDynamicPosition<T> refPoints[NORP]; //!< The reference points for the lateral control.
     };
+    typedef BasicControlPath<double> ControlPath;
 
       /*!< A class to store the internal state for the conscious&#x2F;follow component. */
-    struct FollowTarget {
-        double factor; //!< The influence of the target
-        double lane; //!< Lane ID of the actual lane of the target relative to driver's lane.
-        double distance; //!< The distance to the target to be followed. (in *m*)
-        double velocity; //!< The absolute velocity of the target to be followed. (in *m/s*)
+    template<typename T>
+    struct BasicFollowTarget {
+        T factor; //!< The influence of the target
+        T lane; //!< Lane ID of the actual lane of the target relative to driver's lane.
+        T distance; //!< The distance to the target to be followed. (in *m*)
+        T velocity; //!< The absolute velocity of the target to be followed. (in *m/s*)
     };
+    typedef BasicFollowTarget<double> FollowTarget;
 
     /*!< A class to store signal information. */
-    struct Signal {
+    template<typename T>
+    struct BasicSignal {
         unsigned int id; //!< Unique ID of the signal
-        double ds; //!< Distance to the sign from the current position along the reference line. (in *m*)
+        T ds; //!< Distance to the sign from the current position along the reference line. (in *m*)
         SignalType type; //!< Type of the signal.
-        double value; //!< Value of the signal.
+        T value; //!< Value of the signal.
         TrafficLightColor color; //!< Color of the light bulb.
         TrafficLightIcon icon; //!< Icon/Shape of the traffic light.
         bool subsignal;     //!< if true sign is subsignal to TLS and only valid in certain situations
         bool sign_is_in_use;   //!< indicates that subsign is in use (all paired TLS signals are out of service)
     };
+    typedef BasicSignal<double> Signal;
 
 
     /*!< A class to store target information. */
-    struct Target {
+    template<typename T>
+    struct BasicTarget {
         unsigned int id; //!< Unique ID of the target. id=0 indicates that the target is not defined in the array position
-        double ds; //!< Distance along s to the target center point from the ego driver position. (in *m*)
-        Position xy; //!< Relative position of the target relative to the driver position and heading.
-        double v; //!< Absolute velocity of the target. (in *m/s*)
-        double a; //!< Absolute acceleration of the target. (in *m/s^2*)
-        double d; //!< Lateral offset of the target in its corresponding lane. (in *m*)
-        double psi; //!< Relative yaw angle of the target vehicle to the ego yaw angle. (in *rad*)
+        T ds; //!< Distance along s to the target center point from the ego driver position. (in *m*)
+        BasicPosition<T> xy; //!< Relative position of the target relative to the driver position and heading.
+        T v; //!< Absolute velocity of the target. (in *m/s*)
+        T a; //!< Absolute acceleration of the target. (in *m/s^2*)
+        T d; //!< Lateral offset of the target in its corresponding lane. (in *m*)
+        T psi; //!< Relative yaw angle of the target vehicle to the ego yaw angle. (in *rad*)
         int lane; //!< Lane ID of the actual lane of the target relative to driver's lane.
-        Dimensions size; //!< Width and length of the target.
-        double dsIntersection; //!< Distance along s to the intersection (if target is approaching an intersection)
+        BasicDimensions<T> size; //!< Width and length of the target.
+        T dsIntersection; //!< Distance along s to the intersection (if target is approaching an intersection)
         TargetPriority priority; //!< Priority of the target's lane. Used to determine right of way.
         TargetPosition position; //!< Area in junction of target. Used to determine right of way.
     };
+    typedef BasicTarget<double> Target;
 
     /*!< A class to store the internal state for the decision&#x2F;stopping component. */
-    struct DecisionStopping {
+    template<typename T>
+    struct BasicDecisionStopping {
         unsigned int id; //!< The ID of the stop.
-        double position; //!< The absolute longitudinal position of the stop.
-        double standingTime; //!< The time, the driver shall stand at the stop.
+        T position; //!< The absolute longitudinal position of the stop.
+        T standingTime; //!< The time, the driver shall stand at the stop.
     };
+    typedef BasicDecisionStopping<double> DecisionStopping;
 
     /*!< A class to store the internal state for the decisions components. */
-    struct Decisions {
+    template<typename T>
+    struct BasicDecisions {
         int laneChangeInt; //!< The intention to perform a lane change. The sign defines the direction. The value defines the number of lanes to be changed.
         int laneChangeDec; //!< The decision to perform a lane change. The sign defines the direction. The value defines the number of lanes to be changed.
-        Point lateral; //!< The decision to move to a defined lateral offset within a defined distance or time (mode=0: distance, mode=1: time).
-        DecisionStopping signal; //!< The decision information caused by a signal.
-        DecisionStopping target; //!< The decision information caused by a target.
-        DecisionStopping destination; //!< The decision information caused by a destination.
-        DecisionStopping lane; //!< The decision information caused by a lane change.
+        BasicPoint<T> lateral; //!< The decision to move to a defined lateral offset within a defined distance or time (mode=0: distance, mode=1: time).
+        BasicDecisionStopping<T> signal; //!< The decision information caused by a signal.
+        BasicDecisionStopping<T> target; //!< The decision information caused by a target.
+        BasicDecisionStopping<T> destination; //!< The decision information caused by a destination.
+        BasicDecisionStopping<T> lane; //!< The decision information caused by a lane change.
     };
+    typedef BasicDecisions<double> Decisions;
 
     /*!< A class to store the internal state for the conscious&#x2F;velocity component. */
-    struct ConsciousVelocity {
-        double local; //!< The local velocity. (in *m/s*)
-        double prediction; //!< The prediction mean velocity. (in *m/s*)
+    template<typename T>
+    struct BasicConsciousVelocity {
+        T local; //!< The local velocity. (in *m/s*)
+        T prediction; //!< The prediction mean velocity. (in *m/s*)
     };
+    typedef BasicConsciousVelocity<double> ConsciousVelocity;
 
     /*!< A class to store the internal state for the conscious&#x2F;stop component. */
-    struct ConsciousStop {
-        double ds; //!< The actual distance to the stop point. (in *m*)
-        double dsMax; //!< The reference distance at which the driver decides to stop (in *m*)
+    template<typename T>
+    struct BasicConsciousStop {
+        T ds; //!< The actual distance to the stop point. (in *m*)
+        T dsMax; //!< The reference distance at which the driver decides to stop (in *m*)
         bool standing; //!< A flag to define if the driver has stopped for the desired stop.
         bool priority; //!< A flag to define if the driver drives on a priority lane.
         bool give_way; //!< A flag to define if the driver drives on a give way lane.
     };
+    typedef BasicConsciousStop<double> ConsciousStop;
 
     /*!< A class to store the internal state for the conscious&#x2F;follow component. */
-    struct ConsciousFollow {
-        FollowTarget targets[2];
+    template<typename T>
+    struct BasicConsciousFollow {
+        BasicFollowTarget<T> targets[2];
         bool standing; //!< A flag to define whether the driver wants to keep the vehicle in standstill.
     };
+    typedef BasicConsciousFollow<double> ConsciousFollow;
 
     /*!< A class to store the internal state for the conscious&#x2F;lateral component. */
-    struct ConsciousLateral {
-        ControlPath paths[NOCP]; //!< An array of control paths
+    template<typename T>
+    struct BasicConsciousLateral {
+        BasicControlPath<T> paths[NOCP]; //!< An array of control paths
     };
+    typedef BasicConsciousLateral<double> ConsciousLateral;
 
     /*!< A class to store the internal state for the conscious components. */
-    struct Conscious {
-        ConsciousVelocity velocity; //!< A class to store the internal state for the conscious/velocity component.
-        ConsciousStop stop; //!< A class to store the internal state for the conscious/stop component.
-        ConsciousFollow follow; //!< A class to store the internal state for the conscious/follow component.
-        ConsciousLateral lateral; //!< A class to store the internal state for the conscious/lateral component.
+    template<typename T>
+    struct BasicConscious {
+        BasicConsciousVelocity<T> velocity; //!< A class to store the internal state for the conscious/velocity component.
+        BasicConsciousStop<T> stop; //!< A class to store the internal state for the conscious/stop component.
+        BasicConsciousFollow<T> follow; //!< A class to store the internal state for the conscious/follow component.
+        BasicConsciousLateral<T> lateral; //!< A class to store the internal state for the conscious/lateral component.
     };
+    typedef BasicConscious<double> Conscious;
 
     /*!< A class to store the internal state for the subconscious components. */
-    struct Subconscious {
-        double a; //!< Desired acceleration. (in *m/s^2*)
-        double dPsi; //!< Desired yaw rate. (in *rad/s*)
-        double kappa; //!< Desired curvature. (in *1/m*)
-        double pedal; //!< Desired pedal value.
-        double steering; //!< Desired steering angle.
+    template<typename T>
+    struct BasicSubconscious {
+        T a; //!< Desired acceleration. (in *m/s^2*)
+        T dPsi; //!< Desired yaw rate. (in *rad/s*)
+        T kappa; //!< Desired curvature. (in *1/m*)
+        T pedal; //!< Desired pedal value.
+        T steering; //!< Desired steering angle.
     };
+    typedef BasicSubconscious<double> Subconscious;
 
     /*!< A class to store all memory vehicle states. */
-    struct MemoryVehicle {
-        double s; //!< Absolute travelled distance since the last reset. (in *m*)
+    template<typename T>
+    struct BasicMemoryVehicle {
+        T s; //!< Absolute travelled distance since the last reset. (in *m*)
     };
+    typedef BasicMemoryVehicle<double> MemoryVehicle;
 
     /*!< A class to store all memory lateral control states. */
-    struct MemoryLateral {
-        double time; //!< The time to reach the lateral offset.
-        double startTime; //!< The start time of the lateral motion.
-        double distance; //!< The distance to reach the lateral offset.
-        double startDistance; //!< The start distance of the lateral motion.
-        double offset; //!< The offset to be reached.
+    template<typename T>
+    struct BasicMemoryLateral {
+        T time; //!< The time to reach the lateral offset.
+        T startTime; //!< The start time of the lateral motion.
+        T distance; //!< The distance to reach the lateral offset.
+        T startDistance; //!< The start distance of the lateral motion.
+        T offset; //!< The offset to be reached.
     };
+    typedef BasicMemoryLateral<double> MemoryLateral;
 
     /*!< A class to store all memory lane change states. */
-    struct MemoryLaneChange {
+    template<typename T>
+    struct BasicMemoryLaneChange {
         int switchLane; //!< The lane to be switched to.
         int decision; //!< The decisions to which lane the driver wants to change to. 
-        double startTime; //!< The start time of the lane change. (in *s*)
+        T startTime; //!< The start time of the lane change. (in *s*)
     };
+    typedef BasicMemoryLaneChange<double> MemoryLaneChange;
 
     /*!< A class to store the parameters for velocity components. */
-    struct ParameterVelocityControl {
-        double thwMax; //!< The maximum time headway the driver starts to react (in *s*)
-        double delta; //!< The power for the local speed reaction (see delta in IDM: https://en.wikipedia.org/wiki/Intelligent_driver_model)
-        double deltaPred; //!< The power for the predictive speed reaction
-        double a; //!< The maximum acceleration (in *m/s^2*)
-        double b; //!< The maximum deceleration (in *m/s^2*)
-        double vScale; //!< A scale factor to scale up or down the speed limit
-        double ayMax; //!< Maximum lateral acceleration (in *m/s^2*)
-        double vComfort; //!< Maximum personal comfortable velocity (in *m/s*)
-    };
+    template<typename T>
+    struct BasicParameterVelocityControl {
+        T thwMax; //!< The maximum time headway the driver starts to react (in *s*)
+        T delta; //!< The power for the local speed reaction (see delta in IDM: https://en.wikipedia.org/wiki/Intelligent_driver_model)
+        T deltaPred; //!< The power for the predictive speed reaction
+        T a; //!< The maximum acceleration (in *m/s^2*)
+        T b; //!< The maximum deceleration (in *m/s^2*)
+        T vScale; //!< A scale factor to scale up or down the speed limit
+        T ayMax; //!< Maximum lateral acceleration (in *m/s^2*)
+        T vComfort; //!< Maximum personal comfortable velocity (in *m/s*)
+    };
+    typedef BasicParameterVelocityControl<double> ParameterVelocityControl;
 
     /*!< A class to store the parameters for follow components. */
-    struct ParameterFollowing {
-        double timeHeadway; //!< The time headway the driver tries to reach during following (in *s*)
-        double dsStopped; //!< The distance to the controlled target when stopped
-        double thwMax; //!< The time headway the driver shall earliest react to follow (in *s*)
+    template<typename T>
+    struct BasicParameterFollowing {
+        T timeHeadway; //!< The time headway the driver tries to reach during following (in *s*)
+        T dsStopped; //!< The distance to the controlled target when stopped
+        T thwMax; //!< The time headway the driver shall earliest react to follow (in *s*)
     };
+    typedef BasicParameterFollowing<double> ParameterFollowing;
 
     /*!< A class to store the parameters of the ego vehicle. */
-    struct ParameterVehicle {
-        Dimensions size; //!< Size of the ego vehicle
-        Position pos; //!< The driver's position referenced to the center of the vehicle box defined by *size*
+    template<typename T>
+    struct BasicParameterVehicle {
+        BasicDimensions<T> size; //!< Size of the ego vehicle
+        BasicPosition<T> pos; //!< The driver's position referenced to the center of the vehicle box defined by *size*
     };
+    typedef BasicParameterVehicle<double> ParameterVehicle;
 
     /*!< A class to store the parameters of the steering components. */
-    struct ParameterSteering {
-        double thw[NORP]; //!< The time headway of the reference points
-        double dsMin[NORP]; //!< The minimim distance of the reference points
-        double P[NORP]; //!< The P parameter of the controller
-        double D[NORP]; //!< The D parameter of the controller
+    template<typename T>
+    struct BasicParameterSteering {
+        T thw[NORP]; //!< The time headway of the reference points
+        T dsMin[NORP]; //!< The minimim distance of the reference points
+        T P[NORP]; //!< The P parameter of the controller
+        T D[NORP]; //!< The D parameter of the controller
     };
+    typedef BasicParameterSteering<double> ParameterSteering;
 
     /*!< A class to store the parameters of the stop components. */
-    struct ParameterStopping {
-        double dsGap; //!< The gap between vehicle front and stop sign during a stop.
-        double TMax; //!< Maximum time headway to react for stopping
-        double dsMax; //!< Maximum distance to react for stopping
-        double T; //!< A time headway to parameterize the dynamics of the approaching
-        double tSign; //!< The time the driver stop at a stop sign
-        double vStopped; //!< The velocity at which the driver expects the vehicle to have stopped.
-        double pedalDuringStanding; //!< The pedal value, the driver controls during standing.
-    };
+    template<typename S>
+    struct BasicParameterStopping {
+        S dsGap; //!< The gap between vehicle front and stop sign during a stop.
+        S TMax; //!< Maximum time headway to react for stopping
+        S dsMax; //!< Maximum distance to react for stopping
+        S T; //!< A time headway to parameterize the dynamics of the approaching
+        S tSign; //!< The time the driver stop at a stop sign
+        S vStopped; //!< The velocity at which the driver expects the vehicle to have stopped.
+        S pedalDuringStanding; //!< The pedal value, the driver controls during standing.
+    };
+    typedef BasicParameterStopping<double> ParameterStopping;
 
     /*!< A class to store the parameters of the lane change components. */
-    struct ParameterLaneChange {
-        double bSafe; //!< A safe deceleration
-        double aThreshold; //!< Acceleration threshold
-        double politenessFactor; //!< Politeness factor
-        double time; //!< Time to perform a lane change
+    template<typename T>
+    struct BasicParameterLaneChange {
+        T bSafe; //!< A safe deceleration
+        T aThreshold; //!< Acceleration threshold
+        T politenessFactor; //!< Politeness factor
+        T time; //!< Time to perform a lane change
     };
+    typedef BasicParameterLaneChange<double> ParameterLaneChange;
 
     /*!< A class to store the inputs. */
-    struct Input {
-        VehicleState vehicle; //!< The vehicle state.
-        Horizon horizon; //!< The horizon.
-        Signal signals[NOS]; //!< The signals.
-        Lane lanes[NOL]; //!< The lanes.
-        Target targets[NOT]; //!< The targets.
-    };
+    template<typename T>
+    struct BasicInput {
+        BasicVehicleState<T> vehicle; //!< The vehicle state.
+        BasicHorizon<T> horizon; //!< The horizon.
+        BasicSignal<T> signals[NOS]; //!< The signals.
+        BasicLane<T> lanes[NOL]; //!< The lanes.
+        BasicTarget<T> targets[NOT]; //!< The targets.
+        unsigned int numSignals; //!< Number of set signals at the front of the array (only used if countsValid is set)
+        unsigned int numLanes; //!< Number of set lanes at the front of the array (only used if countsValid is set)
+        unsigned int numTargets; //!< Number of set targets at the front of the array (only used if countsValid is set)
+        unsigned int numHorizon; //!< Number of set horizon points at the front of the arrays (only used if countsValid is set)
+        bool countsValid; //!< Flag whether the counts are valid (true: only the counted elements are scanned, 0 means none; false: all elements are scanned)
+    };
+    typedef BasicInput<double> Input;
 
     /*!< A class to store all internal states. */
-    struct State {
-        double simulationTime; //!< The actual simulation time
-        Decisions decisions; //!< Decision states.
-        Conscious conscious; //!< Conscious states.
-        Subconscious subconscious; //!< Subconscious states.
-        double aux[NOA]; //!< Auxiliary states.
+    template<typename T>
+    struct BasicState {
+        T simulationTime; //!< The actual simulation time
+        BasicDecisions<T> decisions; //!< Decision states.
+        BasicConscious<T> conscious; //!< Conscious states.
+        BasicSubconscious<T> subconscious; //!< Subconscious states.
+        T aux[NOA]; //!< Auxiliary states.
     };
+    typedef BasicState<double> State;
 
     /*!< A class to store all memory states. */
-    struct Memory {
-        MemoryVehicle vehicle; //!< The memory for vehicle states.
-        double velocity; //!< The local maximum velocity.  (in *m/s*)
-        MemoryLateral lateral; //!< The memory for lateral control components.
-        MemoryLaneChange laneChange; //!< The memory for lane change components.
+    template<typename T>
+    struct BasicMemory {
+        BasicMemoryVehicle<T> vehicle; //!< The memory for vehicle states.
+        T velocity; //!< The local maximum velocity.  (in *m/s*)
+        BasicMemoryLateral<T> lateral; //!< The memory for lateral control components.
+        BasicMemoryLaneChange<T> laneChange; //!< The memory for lane change components.
     };
+    typedef BasicMemory<double> Memory;
 
     /*!< A class to store all parameters. */
-    struct Parameters {
-        ParameterVehicle vehicle; //!< Parameters for velocity components.
-        ParameterLaneChange laneChange; //!< Parameters for lane change components.
-        ParameterStopping stop; //!< Parameters for stop components.
-        ParameterVelocityControl velocity; //!< Parameters for velocity components.
-        ParameterFollowing follow; //!< Parameters for follow components.
-        ParameterSteering steering; //!< Parameters for steering components.
+    template<typename T>
+    struct BasicParameters {
+        BasicParameterVehicle<T> vehicle; //!< Parameters for velocity components.
+        BasicParameterLaneChange<T> laneChange; //!< Parameters for lane change components.
+        BasicParameterStopping<T> stop; //!< Parameters for stop components.
+        BasicParameterVelocityControl<T> velocity; //!< Parameters for velocity components.
+        BasicParameterFollowing<T> follow; //!< Parameters for follow components.
+        BasicParameterSteering<T> steering; //!< Parameters for steering components.
     };
+    typedef BasicParameters<double> Parameters;
 
 
 /**
  * @brief The agent model interface.
  * The class implements the data structure of the agent model, consisting of input, state, memory and parameters.
+ * The values are of the scalar type T (@see BasicInput).
  */
-class Interface {
+template<typename T>
+class BasicInterface {
 
 public:
 
-    typedef agent_model::Input Input;
-    typedef agent_model::State State;
-    typedef agent_model::Memory Memory;
-    typedef agent_model::Parameters Parameters;
+    typedef T Scalar; //!< The scalar type of the values
+    typedef BasicInput<T> Input;
+    typedef BasicState<T> State;
+    typedef BasicMemory<T> Memory;
+    typedef BasicParameters<T> Parameters;
+
 
+private:
+
+    Input _inputData{}; //!< The own input buffer of the agent model.
+    State _stateData{}; //!< The own state buffer of the agent model.
 
 protected:
 
-    Input _input{}; //!< The input of the agent model.
-    State _state{}; //!< The state of the agent model.
+    Input *_input = &_inputData; //!< The input of the agent model (own or bound buffer).
+    State *_state = &_stateData; //!< The state of the agent model (own or bound buffer).
     Memory _memory{}; //!< The memory of the agent model.
     Parameters _param{}; //!< The parameters of the agent model.
 
 public:
 
     /** Default constructor */
-    Interface() = default;
+    BasicInterface() = default;
 
     /** Default destructor */
-    virtual ~Interface() = default;
+    virtual ~BasicInterface() = default;
+
+
+    /**
+     * Copy constructor. The copy uses its own input and state buffers, even if the original is bound.
+     * @param other The interface to be copied
+     */
+    BasicInterface(const BasicInterface &other) : _inputData(*other._input), _stateData(*other._state),
+                                                  _memory(other._memory), _param(other._param) {}
+
+
+    /**
+     * Copy assignment. The values are copied into the buffers this interface is bound to.
+     * @param other The interface to be copied
+     * @return This interface
+     */
+    BasicInterface &operator=(const BasicInterface &other) {
+
+        if (this != &other) {
+            *_input = *other._input;
+            *_state = *other._state;
+            _memory = other._memory;
+            _param = other._param;
+        }
+
+        return *this;
+
+    }
+
+
+    /**
+    * Binds the model to externally owned input and state buffers (e.g. a slot of a simulator array or a
+    * shared-memory page), which are then read and written in place during the step. The buffers are not copied and
+    * must outlive the binding. A nullptr binds the own buffer again. Resolved injections stay valid, because they are
+    * applied to the buffers bound at the time of the step.
+    * @param input The input buffer
+    * @param state The state buffer
+    */
+    void bind(Input *input, State *state) {
+
+        auto misaligned = [](const void *p, size_t a) { return reinterpret_cast<std::uintptr_t>(p) % a != 0; };
+        if (misaligned(input, alignof(Input)) || misaligned(state, alignof(State)))
+            throw std::invalid_argument("bound buffers must be aligned.");
+
+        _input = input == nullptr ? &_inputData : input;
+        _state = state == nullptr ? &_stateData : state;
+
+    }
+
+
+    /**
+    * Returns whether the input or the state is bound to an external buffer
+    * @return Flag whether bound
+    */
+    bool bound() const {
+        return _input != &_inputData || _state != &_stateData;
+    }
 
 
     /**
@@ -395,7 +534,7 @@ public:
     * @return The _input point
     */
     Input *getInput() {
-        return &_input;
+        return _input;
     }
 
     /**
@@ -403,7 +542,7 @@ public:
     * @return The const _input point
     */
     const Input *getInput() const {
-        return &_input;
+        return _input;
     }
 
 
@@ -412,7 +551,7 @@ public:
     * @return The _state point
     */
     State *getState() {
-        return &_state;
+        return _state;
     }
 
     /**
@@ -420,7 +559,7 @@ public:
     * @return The const _state point
     */
     const State *getState() const {
-        return &_state;
+        return _state;
     }
 
 
@@ -461,6 +600,8 @@ public:
 
 };
 
+typedef BasicInterface<double> Interface; //!< The interface of the agent model with double values
+
 } // namespace
 
 #endif // AGENT_MODEL_INTERFACE_H
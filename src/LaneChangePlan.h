@@ -0,0 +1,221 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// LaneChangePlan.h
+
+#ifndef SIMDRIVER_LANE_CHANGE_PLAN_H
+#define SIMDRIVER_LANE_CHANGE_PLAN_H
+
+#include <cmath>
+#include "Interface.h"
+#include "InputTables.h"
+#include "Snapshot.h"
+
+namespace agent_model {
+
+
+    /**
+     * @brief A plan of lane changes towards the lane with the longest route
+     * The plan stores the target lane relative to the ego lane, which is reached by a sequence of single lane changes.
+     * The plan is cached between the steps and updated incrementally: a finished lane change shifts the target (@see
+     * switched()) and the cached target is only checked in each step. The plan is derived again, if a lane up to the
+     * target cannot be passed anymore or the route of the target lane has changed relative to the ego lane.
+     * @tparam T The scalar type of the lanes
+     */
+    template<typename T>
+    class BasicLaneChangePlan {
+
+        static constexpr double EPS_ROUTE = 1e-3; //!< Tolerance of the route difference (in *m*)
+
+        int _target = 0;         //!< The target lane relative to the ego lane (0: no plan)
+        T _margin = 0.0;         //!< The route of the target lane relative to the ego lane's route (in *m*)
+        bool _rebase = false;    //!< Flag whether the margin is taken from the next update (after a lane change)
+
+    public:
+
+        /**
+         * Resets the plan
+         */
+        void reset() {
+
+            _target = 0;
+            _margin = 0.0;
+            _rebase = false;
+
+        }
+
+
+        /**
+         * Shifts the plan after a finished lane change
+         * @param lanes The number of lanes the ego vehicle has changed (positive: to the left)
+         */
+        void switched(int lanes) {
+
+            if (_target == 0 || lanes == 0)
+                return;
+
+            _target -= lanes;
+            _rebase = true;
+
+        }
+
+
+        /**
+         * Checks the cached plan and derives a new one if it is not valid anymore. A lane can be passed, if it is
+         * accessible and not closed before it is reached (a lane change is assumed to take the given length). The
+         * target is the passable lane with the longest route, which is at least as long as the ego lane's route. Of
+         * equal routes, the closest lane is taken (the left lane first).
+         * @param table The lanes of the step
+         * @param length The length of a lane change (in *m*)
+         * @return The target lane relative to the ego lane (0: no lane change)
+         */
+        int update(const BasicLaneTable<T> &table, T length) {
+
+            using namespace std;
+
+            auto ego = table.lane(0);
+            if (!ego) {
+                reset();
+                return 0;
+            }
+
+            // check cached plan (all lanes up to the target passable, route not shorter than the ego lane's and
+            // unchanged)
+            if (_target != 0) {
+
+                int dir = _target > 0 ? 1 : -1;
+                bool valid = true;
+                for (int k = 1; valid && k <= dir * _target; ++k)
+                    valid = passable(table.lane(dir * k), k, length);
+
+                auto target = table.lane(_target);
+                valid = valid && target->route >= ego->route
+                        && (_rebase || abs(target->route - ego->route - _margin) <= EPS_ROUTE);
+
+                if (valid) {
+                    _margin = target->route - ego->route;
+                    _rebase = false;
+                    return _target;
+                }
+
+            }
+
+            // plan: search the passable lanes to the left and to the right
+            reset();
+            T route = ego->route;
+            int distance = 0;
+
+            for (int dir = 1; dir >= -1; dir -= 2) {
+                for (int k = 1; k <= BasicLaneTable<T>::RANGE; ++k) {
+
+                    auto lane = table.lane(dir * k);
+                    if (!passable(lane, k, length))
+                        break;
+
+                    // longer route or equal route and closer
+                    if (lane->route > route || (lane->route == route && (_target == 0 || k < distance))) {
+                        _target = dir * k;
+                        route = lane->route;
+                        distance = k;
+                    }
+
+                }
+            }
+
+            _margin = route - ego->route;
+            return _target;
+
+        }
+
+
+        /**
+         * Checks whether a lane can be passed: it is accessible and not closed before it is reached
+         * @param lane The lane (nullptr: no lane)
+         * @param k The number of lane changes needed to reach the lane
+         * @param length The length of a lane change (in *m*)
+         * @return Flag whether the lane can be passed
+         */
+        static bool passable(const BasicLane<T> *lane, int k, T length) {
+
+            return lane && lane->access == ACC_ACCESSIBLE && !(lane->closed >= 0.0 && lane->closed < (double) k * length);
+
+        }
+
+
+        /**
+         * Returns the target lane of the plan
+         * @return The target lane relative to the ego lane (0: no plan)
+         */
+        int target() const {
+
+            return _target;
+
+        }
+
+
+        /**
+         * Returns the number of bytes needed to store the plan in a snapshot
+         * @return Number of bytes
+         */
+        size_t snapshotSize() const {
+
+            return sizeof(_target) + sizeof(_margin) + sizeof(_rebase);
+
+        }
+
+
+        /**
+         * Writes the plan to the snapshot buffer
+         * @param buffer Buffer to be written to
+         * @return Pointer behind the written data
+         */
+        char *save(char *buffer) const {
+
+            buffer = snapshot::write(buffer, _target);
+            buffer = snapshot::write(buffer, _margin);
+            return snapshot::write(buffer, _rebase);
+
+        }
+
+
+        /**
+         * Restores the plan from the snapshot buffer
+         * @param buffer Buffer to be read from
+         * @return Pointer behind the read data
+         */
+        const char *restore(const char *buffer) {
+
+            buffer = snapshot::read(buffer, _target);
+            buffer = snapshot::read(buffer, _margin);
+            return snapshot::read(buffer, _rebase);
+
+        }
+
+    };
+
+    typedef BasicLaneChangePlan<double> LaneChangePlan; //!< The lane change plan of the double lanes
+
+
+} // namespace agent_model
+
+#endif // SIMDRIVER_LANE_CHANGE_PLAN_H
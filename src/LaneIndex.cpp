@@ -0,0 +1,273 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// LaneIndex.cpp
+
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "LaneIndex.h"
+
+namespace agent_model {
+
+
+    LaneIndex::LaneIndex(unsigned int lanes, double length) : _length(length), _lanes(lanes) {
+
+        if (lanes == 0)
+            throw std::invalid_argument("number of lanes must be positive.");
+
+        if (!(length > 0.0))
+            throw std::invalid_argument("length must be positive.");
+
+    }
+
+
+    void LaneIndex::clear() {
+
+        for (auto &lane : _lanes)
+            lane.clear();
+
+        _slots.clear();
+
+    }
+
+
+    void LaneIndex::update(unsigned int index, unsigned int lane, double s) {
+
+        if (lane >= _lanes.size())
+            throw std::invalid_argument("lane is out of range.");
+
+        if (index >= _slots.size())
+            _slots.resize(index + 1);
+
+        auto &slot = _slots[index];
+
+        // same lane: only update the position
+        if (slot.lane == (int) lane) {
+            _lanes[lane][slot.pos].s = s;
+            return;
+        }
+
+        // move to the other lane (appended, placed by sort)
+        remove(index);
+
+        slot.lane = (int) lane;
+        slot.pos = (unsigned int) _lanes[lane].size();
+        _lanes[lane].push_back({s, index});
+
+    }
+
+
+    void LaneIndex::remove(unsigned int index) {
+
+        if (index >= _slots.size() || _slots[index].lane < 0)
+            return;
+
+        auto &slot = _slots[index];
+        auto &entries = _lanes[slot.lane];
+
+        // shift the following entries
+        entries.erase(entries.begin() + slot.pos);
+        for (auto i = slot.pos; i < entries.size(); ++i)
+            _slots[entries[i].index].pos = i;
+
+        slot.lane = -1;
+
+    }
+
+
+    void LaneIndex::sort() {
+
+        for (auto &entries : _lanes) {
+
+            // insertion sort (linear for nearly sorted arrays)
+            for (size_t i = 1; i < entries.size(); ++i) {
+
+                auto e = entries[i];
+                auto j = i;
+                for (; j > 0 && entries[j - 1].s > e.s; --j)
+                    entries[j] = entries[j - 1];
+
+                entries[j] = e;
+
+            }
+
+            // update slots
+            for (size_t i = 0; i < entries.size(); ++i)
+                _slots[entries[i].index].pos = (unsigned int) i;
+
+        }
+
+    }
+
+
+    unsigned int LaneIndex::ahead(unsigned int index, int lane, Neighbour *neighbours, unsigned int k) const {
+
+        Cursor c;
+        start(index, lane, true, c);
+
+        unsigned int n = 0;
+        for (; n < k && !std::isinf(c.ds); ++n, advance(c))
+            neighbours[n] = {c.index, c.lane, c.ds};
+
+        return n;
+
+    }
+
+
+    unsigned int LaneIndex::behind(unsigned int index, int lane, Neighbour *neighbours, unsigned int k) const {
+
+        Cursor c;
+        start(index, lane, false, c);
+
+        unsigned int n = 0;
+        for (; n < k && !std::isinf(c.ds); ++n, advance(c))
+            neighbours[n] = {c.index, c.lane, c.ds};
+
+        return n;
+
+    }
+
+
+    unsigned int LaneIndex::nearest(unsigned int index, Neighbour *neighbours, unsigned int k) const {
+
+        return merge(index, k, [neighbours](unsigned int i, const Neighbour &nb) { neighbours[i] = nb; });
+
+    }
+
+
+    unsigned int LaneIndex::fill(unsigned int index, const Target *states, Target *targets, unsigned int n) const {
+
+        auto m = merge(index, n, [states, targets](unsigned int i, const Neighbour &nb) {
+            targets[i] = states[nb.index];
+            targets[i].ds = nb.ds;
+            targets[i].lane = nb.lane;
+        });
+
+        // reset unused targets
+        for (unsigned int i = m; i < n; ++i) {
+            targets[i] = Target{};
+            targets[i].ds = INFINITY;
+            targets[i].dsIntersection = INFINITY;
+        }
+
+        return m;
+
+    }
+
+
+    void LaneIndex::fill(const Target *states, Target (*targets)[NOT]) const {
+
+        for (unsigned int i = 0; i < _slots.size(); ++i) {
+            if (_slots[i].lane >= 0)
+                fill(i, states, targets[i], NOT);
+        }
+
+    }
+
+
+    void LaneIndex::start(unsigned int index, int lane, bool forward, Cursor &cursor) const {
+
+        cursor = Cursor{};
+
+        if (index >= _slots.size() || _slots[index].lane < 0)
+            throw std::invalid_argument("vehicle is not in the index.");
+
+        auto &slot = _slots[index];
+        auto l = slot.lane + lane;
+        if (l < 0 || l >= (int) _lanes.size())
+            return;
+
+        auto &entries = _lanes[l];
+
+        cursor.entries = &entries;
+        cursor.self = index;
+        cursor.s = _lanes[slot.lane][slot.pos].s;
+        cursor.lane = lane;
+        cursor.forward = forward;
+        cursor.steps = entries.size();
+
+        // first entry not behind the vehicle (on the own lane: the vehicle itself)
+        long pos;
+        if (lane == 0)
+            pos = slot.pos;
+        else
+            pos = std::lower_bound(entries.begin(), entries.end(), cursor.s,
+                    [](const Entry &e, double v) { return e.s < v; }) - entries.begin();
+
+        cursor.next = forward ? pos : pos - 1;
+
+        advance(cursor);
+
+    }
+
+
+    void LaneIndex::advance(Cursor &cursor) const {
+
+        cursor.ds = INFINITY;
+
+        if (cursor.entries == nullptr)
+            return;
+
+        auto &entries = *cursor.entries;
+        auto size = (long) entries.size();
+        auto ring = !std::isinf(_length);
+
+        // each entry is visited once at most
+        while (cursor.steps > 0) {
+
+            --cursor.steps;
+
+            // wrap on a ring, stop at the end of an open road
+            if (cursor.next >= size || cursor.next < 0) {
+
+                if (!ring)
+                    return;
+
+                cursor.next = cursor.forward ? 0 : size - 1;
+                cursor.offset = cursor.forward ? _length : -_length;
+
+            }
+
+            auto &e = entries[cursor.next];
+            cursor.next += cursor.forward ? 1 : -1;
+
+            if (e.index == cursor.self)
+                continue;
+
+            // the distances increase monotonically, the walk ends at half of the ring
+            double ds = e.s - cursor.s + cursor.offset;
+            if (ring && (cursor.forward ? ds >= 0.5 * _length : ds < -0.5 * _length))
+                return;
+
+            cursor.index = e.index;
+            cursor.ds = ds;
+            return;
+
+        }
+
+    }
+
+
+}
@@ -0,0 +1,267 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// LaneIndex.h
+
+
+#ifndef SIMDRIVER_LANE_INDEX_H
+#define SIMDRIVER_LANE_INDEX_H
+
+#include <cmath>
+#include <vector>
+
+#include "Interface.h"
+
+namespace agent_model {
+
+
+    /**
+     * @brief A per-lane spatial index of a vehicle population to find neighbours and assemble targets
+     * The vehicles are stored in one array per lane, sorted by their position s. Since the vehicles move only a little
+     * from step to step, the arrays are re-sorted by insertion sort, which takes linear time for nearly sorted arrays.
+     * The index answers queries for the k nearest vehicles ahead of and behind a vehicle on its lane and on the
+     * neighbouring lanes, and fills the target arrays of the agents without scanning the whole population. The road
+     * is either open (length = inf) or a ring with the given length, on which the positions are in [0, length) and the
+     * distances are wrapped into [-length/2, length/2).
+     */
+    class LaneIndex {
+
+    public:
+
+        static const int RANGE = 2; //!< The range of lanes of the nearest vehicles and targets (-RANGE to +RANGE)
+
+        /**
+         * @brief A neighbour of a vehicle
+         */
+        struct Neighbour {
+            unsigned int index; //!< The index of the neighbouring vehicle
+            int lane;           //!< The lane relative to the vehicle (positive: left)
+            double ds;          //!< The distance from the vehicle to the neighbour (in *m*, positive: ahead)
+        };
+
+
+    protected:
+
+        /**
+         * @brief An entry of a lane
+         */
+        struct Entry {
+            double s;           //!< The position of the vehicle
+            unsigned int index; //!< The index of the vehicle
+        };
+
+
+        /**
+         * @brief The location of a vehicle in the index
+         */
+        struct Slot {
+            int lane = -1;          //!< The lane of the vehicle (-1: not in the index)
+            unsigned int pos = 0;   //!< The position of the vehicle in the lane array
+        };
+
+
+        /**
+         * @brief A cursor walking along a lane array in one direction, starting at the position of a vehicle
+         */
+        struct Cursor {
+            const std::vector<Entry> *entries = nullptr; //!< The lane array
+            unsigned int self = 0;      //!< The index of the vehicle (skipped)
+            double s = 0.0;             //!< The position of the vehicle
+            int lane = 0;               //!< The relative lane
+            bool forward = true;        //!< Flag whether the cursor walks ahead
+            long next = 0;              //!< The position of the next entry in the lane array
+            unsigned long steps = 0;    //!< The number of remaining entries
+            double offset = 0.0;        //!< The offset added to the distances after wrapping on a ring
+            unsigned int index = 0;     //!< The index of the current neighbour
+            double ds = INFINITY;       //!< The distance to the current neighbour (inf: no more neighbours)
+        };
+
+
+        double _length;                             //!< The length of the ring (inf: open road)
+        std::vector<std::vector<Entry>> _lanes{};   //!< The sorted lane arrays
+        std::vector<Slot> _slots{};                 //!< The slots of the vehicles
+
+
+    public:
+
+        /**
+         * Constructor
+         * @param lanes The number of lanes
+         * @param length The length of the ring (inf: open road)
+         */
+        explicit LaneIndex(unsigned int lanes = 1, double length = INFINITY);
+
+
+        /**
+         * Removes all vehicles from the index
+         */
+        void clear();
+
+
+        /**
+         * Sets the lane and position of a vehicle (the index is sorted by calling sort())
+         * @param index The index of the vehicle
+         * @param lane The lane of the vehicle (0: rightmost lane)
+         * @param s The position of the vehicle
+         */
+        void update(unsigned int index, unsigned int lane, double s);
+
+
+        /**
+         * Removes a vehicle from the index
+         * @param index The index of the vehicle
+         */
+        void remove(unsigned int index);
+
+
+        /**
+         * Sorts the lane arrays after the positions were updated
+         */
+        void sort();
+
+
+        /**
+         * Returns the k nearest vehicles ahead of a vehicle on a lane, ordered by distance
+         * @param index The index of the vehicle
+         * @param lane The lane relative to the vehicle (positive: left)
+         * @param neighbours The array to be filled
+         * @param k The maximum number of neighbours
+         * @return The number of neighbours found
+         */
+        unsigned int ahead(unsigned int index, int lane, Neighbour *neighbours, unsigned int k) const;
+
+
+        /**
+         * Returns the k nearest vehicles behind a vehicle on a lane, ordered by distance
+         * @param index The index of the vehicle
+         * @param lane The lane relative to the vehicle (positive: left)
+         * @param neighbours The array to be filled
+         * @param k The maximum number of neighbours
+         * @return The number of neighbours found
+         */
+        unsigned int behind(unsigned int index, int lane, Neighbour *neighbours, unsigned int k) const;
+
+
+        /**
+         * Returns the k nearest vehicles (by absolute distance) on the lane of a vehicle and the lanes up to RANGE
+         * lanes to the left and right
+         * @param index The index of the vehicle
+         * @param neighbours The array to be filled
+         * @param k The maximum number of neighbours
+         * @return The number of neighbours found
+         */
+        unsigned int nearest(unsigned int index, Neighbour *neighbours, unsigned int k) const;
+
+
+        /**
+         * Fills the targets of a vehicle with its nearest vehicles. The targets are copied from the states of the
+         * vehicles, only the distance ds and the relative lane are set by the index. Unused targets are reset (id = 0,
+         * ds = inf). The number of targets is not limited to NOT (@see AgentModel::bindTargets()).
+         * @param index The index of the vehicle
+         * @param states The target descriptions of all vehicles (indexed by vehicle index)
+         * @param targets The targets to be filled
+         * @param n The number of targets
+         * @return The number of targets set
+         */
+        unsigned int fill(unsigned int index, const Target *states, Target *targets, unsigned int n = NOT) const;
+
+
+        /**
+         * Fills the targets of all vehicles in the index
+         * @param states The target descriptions of all vehicles (indexed by vehicle index)
+         * @param targets The target arrays of all vehicles (indexed by vehicle index, each with NOT elements)
+         */
+        void fill(const Target *states, Target (*targets)[NOT]) const;
+
+
+        /**
+         * Returns the number of lanes
+         * @return The number of lanes
+         */
+        unsigned int lanes() const {
+            return (unsigned int) _lanes.size();
+        }
+
+
+    protected:
+
+        /**
+         * Merges the cursors on the lanes -RANGE to +RANGE by absolute distance and passes the k nearest neighbours in
+         * order
+         * @param index The index of the vehicle
+         * @param k The maximum number of neighbours
+         * @param emit Function called with the rank and the neighbour
+         * @return The number of neighbours found
+         */
+        template<typename F>
+        unsigned int merge(unsigned int index, unsigned int k, F emit) const {
+
+            // one cursor per direction on the lanes -RANGE to +RANGE
+            Cursor cursors[2 * (2 * RANGE + 1)];
+            for (int i = 0; i < 2 * (2 * RANGE + 1); ++i)
+                start(index, i / 2 - RANGE, i % 2 == 0, cursors[i]);
+
+            unsigned int n = 0;
+            for (; n < k; ++n) {
+
+                Cursor *best = nullptr;
+                for (auto &c : cursors) {
+                    if (!std::isinf(c.ds) && (best == nullptr || std::abs(c.ds) < std::abs(best->ds)))
+                        best = &c;
+                }
+
+                if (best == nullptr)
+                    break;
+
+                emit(n, Neighbour{best->index, best->lane, best->ds});
+                advance(*best);
+
+            }
+
+            return n;
+
+        }
+
+
+        /**
+         * Initializes a cursor on a lane relative to a vehicle
+         * @param index The index of the vehicle
+         * @param lane The lane relative to the vehicle
+         * @param forward Flag whether the cursor walks ahead
+         * @param cursor The cursor to be initialized
+         */
+        void start(unsigned int index, int lane, bool forward, Cursor &cursor) const;
+
+
+        /**
+         * Moves the cursor to the next entry and updates the distance (inf if no more entries are in range)
+         * @param cursor The cursor
+         */
+        void advance(Cursor &cursor) const;
+
+    };
+
+
+}
+
+#endif // SIMDRIVER_LANE_INDEX_H
@@ -0,0 +1,591 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// LongitudinalStages.h
+
+#ifndef SIMDRIVER_LONGITUDINAL_STAGES_H
+#define SIMDRIVER_LONGITUDINAL_STAGES_H
+
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include "Interface.h"
+#include "VelocityHorizon.h"
+#include "StopHorizon.h"
+#include "Filter.h"
+#include "TargetSummary.h"
+#include "InputTables.h"
+#include "RightOfWay.h"
+#include "model_collection.h"
+
+namespace agent_model {
+
+
+    /*
+     * The longitudinal stages of the agent model (stopping, velocity, following and the resulting reactions). The
+     * stages are generic over the input and state structs, which only need the members used by the stage (e.g.
+     * in.vehicle, in.horizon.ds/kappa and state.conscious.velocity), and over the scalar type T of the parameters and
+     * internal horizons. They are shared by AgentModel and the compact AgentModelLongitudinal, so both calculate the
+     * identical acceleration.
+     */
+
+
+    /**
+     * Calculates process of stopping and starting (stop points of signals, junction targets, destination and end of route)
+     * @param in The input
+     * @param state The state
+     * @param ego The ego lane (nullptr if not reported, then no stop point is set for the end of route)
+     * @param param The parameters
+     * @param signals The signal table of the step
+     * @param summary The target summary of the step
+     * @tparam Rules The right-of-way rule set (@see RightBeforeLeft)
+     */
+    template<typename Rules = RightBeforeLeft, typename I, typename S, typename T>
+    void decisionProcessStop(const I &in, S &state, const BasicLane<T> *ego, const BasicParameters<T> &param,
+                             const BasicSignalTable<T> &signals, const BasicTargetSummary<T> &summary) {
+
+        using namespace std;
+
+        // unset decision
+        state.decisions.signal.id = std::numeric_limits<unsigned int>::max();
+        state.decisions.signal.position = INFINITY;
+        state.decisions.signal.standingTime = INFINITY;
+
+        state.decisions.target.id = std::numeric_limits<unsigned int>::max();
+        state.decisions.target.position = INFINITY;
+        state.decisions.target.standingTime = INFINITY;
+
+        state.decisions.destination.id = std::numeric_limits<unsigned int>::max();
+        state.decisions.destination.position = INFINITY;
+        state.decisions.destination.standingTime = INFINITY;
+
+        state.decisions.lane.id = std::numeric_limits<unsigned int>::max();
+        state.decisions.lane.position = INFINITY;
+        state.decisions.lane.standingTime = INFINITY;
+
+        // add stop point because of destination point
+        if (in.horizon.destinationPoint > 0)
+        {
+            state.decisions.destination.id = 3;
+            state.decisions.destination.position = in.vehicle.s + in.horizon.destinationPoint;
+            state.decisions.destination.standingTime = INFINITY;
+        }
+
+        // add stop point because of end of route (only if the ego lane is reported)
+        if (ego) {
+            state.decisions.lane.id = 4;
+            state.decisions.lane.position = in.vehicle.s + ego->route;
+            // only apply standing time when hard lane change required at end of route
+            if (ego->lane_change == 2) {
+                state.decisions.lane.standingTime = INFINITY;
+            }
+            else {
+                state.decisions.lane.standingTime = 0;
+            }
+        }
+
+        // not yet decided about to stop or drive
+        bool stop = false;
+        bool drive = false;
+        bool found_signal = false;
+
+        // mark ds of the next relevant traffic light and sign
+        T ds_rel_tls = INFINITY;
+        T ds_rel_sgn = INFINITY;
+        const agent_model::BasicSignal<T>* rel = nullptr;
+        auto rel_tls = signals.nextTrafficLight();
+        auto rel_sgn = signals.nextSign();
+
+        if (rel_tls) {
+            ds_rel_tls = rel_tls->ds;
+            found_signal = true;
+        }
+        if (rel_sgn) {
+            ds_rel_sgn = rel_sgn->ds;
+            found_signal = true;
+        }
+
+        if (found_signal)
+        {
+            // take closest signal 
+            // (take traffic light even if 10 meters behind potential sign)
+            if (ds_rel_tls <= ds_rel_sgn + 10) {
+                rel = rel_tls;
+            } else {
+                rel = rel_sgn;
+            }
+            // calculate net distance
+            auto ds = rel->ds - param.stop.dsGap + param.vehicle.pos.x - param.vehicle.size.length * 0.5;
+
+            // trafficlight
+            if (rel->type == agent_model::SignalType::SIGNAL_TLS)
+            {
+                // case red trafficlight
+                if (rel->color == agent_model::TrafficLightColor::COLOR_RED) {
+                
+                    state.conscious.stop.give_way = true;
+                
+                    // set stop point for INFINITY ( = until removed)
+                    state.decisions.signal.id = 1;
+                    state.decisions.signal.position = in.vehicle.s + ds;
+                    state.decisions.signal.standingTime = INFINITY;
+                
+                    stop = true;
+                    return;
+                }
+
+                // case green trafficlight
+                else if (rel->color == agent_model::TrafficLightColor::COLOR_GREEN) {
+                    state.conscious.stop.priority = true;
+
+                    // "remove" stop point (by setting standing standingTime = 0)
+                    state.decisions.signal.id = 1;
+                    state.decisions.signal.position = in.vehicle.s + ds;
+                    state.decisions.signal.standingTime = 0;
+
+                    // drive if green and the maneuver is released by the light (e.g. straight or left turn arrow)
+                    if (RightOfWayRules<Rules>::table.green(rel->icon, in.vehicle.maneuver))
+                        drive = true;
+                } 
+            }
+                
+            // signal
+            if (rel->type != agent_model::SignalType::SIGNAL_TLS)
+            {
+                // case stop signal
+                if (rel->type == agent_model::SignalType::SIGNAL_STOP) {
+                    state.conscious.stop.give_way = true;
+                    stop = true;
+                }
+            
+                // case yield signal
+                else if (rel->type == agent_model::SignalType::SIGNAL_YIELD) {
+                    state.conscious.stop.give_way = true;
+                }
+
+                // case priority signal
+                else if (rel->type == agent_model::SignalType::SIGNAL_PRIORITY) {
+                    state.conscious.stop.priority = true;
+                }
+            }
+        }
+
+        // add stop point because of signal (only set if a signal was found)
+        if (stop && rel)
+        {
+            state.decisions.signal.id = 1;
+            state.decisions.signal.position = in.vehicle.s + rel->ds;
+            state.decisions.signal.standingTime = param.stop.tSign;
+        }
+
+        // if not yet decided to drive or stop -> consider targets
+        if (!drive && !stop) {   
+
+            // ignore if not approaching intersection
+            if (in.vehicle.dsIntersection == INFINITY)
+                return;
+        
+            // ignore if on priority lane and driving straight (or right - for now)
+            if (state.conscious.stop.priority && 
+               (in.vehicle.maneuver == agent_model::Maneuver::STRAIGHT ||
+                in.vehicle.maneuver == agent_model::Maneuver::TURN_RIGHT))
+                return;
+
+            // process all relevant targets (set, in junction area and not on path) by the decision table
+            const auto &rules = RightOfWayRules<Rules>::table;
+            bool priority = state.conscious.stop.priority;
+            bool giveWay = state.conscious.stop.give_way;
+
+            unsigned int nj;
+            auto junction = summary.junction(nj);
+            for (unsigned int j = 0; j < nj; ++j)
+            {
+                auto &t = summary.target(junction[j]);
+
+                switch (rules.target(priority, giveWay, in.vehicle.maneuver, t)) {
+                    case ROW_YIELD:
+                        stop = true;
+                        break;
+                    case ROW_FIRST_COME:
+                        // check if ego reaches junction earlier, otherwise stop
+                        if (!(in.vehicle.dsIntersection / in.vehicle.v < t.dsIntersection / t.v))
+                            stop = true;
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            // add stop point because of target
+            if (stop)
+            {
+                // try to stop 10m before intersection or take ds of the signal
+                T ds_stop;
+                if (isinf(ds_rel_sgn) || !rel)
+                    ds_stop = std::max(T(0.0), in.vehicle.dsIntersection - 10);
+                else
+                    ds_stop = std::max(T(0.0), rel->ds);
+                state.decisions.target.id = 2;
+                state.decisions.target.position = in.vehicle.s + ds_stop;
+                state.decisions.target.standingTime = param.stop.tSign;
+            }
+        }
+    }
+
+
+    /**
+     * Calculates the target speed based on rules, the curvature of the track
+     * @param in The input
+     * @param state The state
+     * @param memory The memory
+     * @param param The parameters
+     * @param velocityHorizon The velocity horizon
+     * @param signals The signal table of the step
+     */
+    template<typename I, typename S, typename M, typename T>
+    void consciousVelocity(const I &in, S &state, M &memory, const BasicParameters<T> &param,
+                           BasicVelocityHorizon<T> &velocityHorizon, const BasicSignalTable<T> &signals) {
+
+        using namespace std;
+
+        // set max comfortable speed
+        T vComf = param.velocity.vComfort;
+        velocityHorizon.setMaxVelocity(param.velocity.vComfort);
+
+        // some variables
+        T dsLoc = -1.0 * INFINITY;
+        T vLoc = INFINITY;
+
+        // start for interval
+        T s0 = in.vehicle.s;
+        T v0 = INFINITY;
+
+        // unset the speed rules
+        velocityHorizon.resetSpeedRule();
+
+        // find last rule
+        unsigned int nl;
+        auto limits = signals.speedLimits(nl);
+        for (unsigned int i = 0; i < nl; ++i) {
+
+            // get speed limit
+            const auto &e = signals.signal(limits[i]);
+
+            // speed
+            T v = e.value < 0 ? T(INFINITY) : e.value / 3.6;
+
+            // check if closest rule
+            if (e.ds < 0.0 && dsLoc < e.ds) {
+                vLoc = v;
+                dsLoc = e.ds;
+            }
+
+            // calculate end of interval
+            T s1 = in.vehicle.s + e.ds;
+
+            // add rule to horizon
+            if(s1 > s0)
+                velocityHorizon.updateSpeedRuleInInterval(s0, s1, v0);
+
+            s0 = s1;
+            v0 = v;
+
+        }
+
+        // add rule to horizon
+        velocityHorizon.updateSpeedRuleInInterval(s0, INFINITY, v0);
+
+        // save local speed limit to state
+        memory.velocity = isinf(vLoc) ? memory.velocity : vLoc;
+        T vRule = memory.velocity;
+
+        // calculate local curve speed
+        auto nh = agent_model::count(in.countsValid, in.numHorizon, agent_model::NOH);
+        T kappaCurrent = nh < 2 || isinf(in.horizon.ds[1])
+                ? T(0.0) : agent_model::interpolate<T>(0.0, in.horizon.ds, in.horizon.kappa, nh);
+        T vCurve = max(T(0.0), sqrt(abs(param.velocity.ayMax / kappaCurrent)));
+
+        // iterate over horizon points
+        for(unsigned int i = 0; i < nh; ++i) {
+
+            // get position and speed
+            T s = in.vehicle.s + in.horizon.ds[i];
+            T v = max(T(0.0), sqrt(abs(param.velocity.ayMax / in.horizon.kappa[i])));
+
+            // set speed
+            velocityHorizon.updateContinuousPoint(s, v);
+
+        }
+
+        // sets the local speed
+        state.conscious.velocity.local = min(min(vComf, vRule), vCurve);
+
+        // calculate interval
+        T sI0 = in.vehicle.s;
+        T sI1 = sI0 + std::max(T(1.0), in.vehicle.v * param.velocity.thwMax);
+
+        // calculate mean predictive velocity
+        state.conscious.velocity.prediction = velocityHorizon.mean(sI0, sI1, param.velocity.deltaPred);
+
+    }
+
+
+    /**
+     * Calculate the process of the stop maneuver
+     * @param in The input
+     * @param state The state
+     * @param param The parameters
+     * @param stopHorizon The stop horizon
+     */
+    template<typename I, typename S, typename T>
+    void consciousStop(const I &in, S &state, const BasicParameters<T> &param, BasicStopHorizon<T> &stopHorizon) {
+
+        using namespace std;
+
+        // add new signals
+        agent_model::BasicDecisionStopping<T> signal = state.decisions.signal;
+        agent_model::BasicDecisionStopping<T> target = state.decisions.target;
+        agent_model::BasicDecisionStopping<T> destination = state.decisions.destination;
+        agent_model::BasicDecisionStopping<T> lane = state.decisions.lane;
+
+        // check position and add stop point
+        if(!isinf(signal.position))
+            stopHorizon.addStopPoint(signal.id, signal.position, signal.standingTime);
+
+        if(!isinf(target.position))
+            stopHorizon.addStopPoint(target.id, target.position, target.standingTime);
+
+        if(!isinf(destination.position))
+            stopHorizon.addStopPoint(destination.id, destination.position, destination.standingTime);
+
+        if(!isinf(lane.position))
+            stopHorizon.addStopPoint(lane.id, lane.position, lane.standingTime);
+
+        // get stop
+        auto stop = stopHorizon.getNextStop();
+        auto standing = false;
+
+        // check standing
+        if(!isinf(stop.ds)) {
+
+            // is standing?
+            standing = in.vehicle.v < param.stop.vStopped && stop.ds <= 0.5;
+
+            // mark as stopped, TODO: mark all of them
+            if(standing)
+                stopHorizon.stopped(stop.id, state.simulationTime);
+
+        }
+
+        // default values
+        state.conscious.stop.ds = stop.ds;
+        state.conscious.stop.dsMax = stop.interval;
+        state.conscious.stop.standing = standing;
+
+    }
+
+
+    /**
+     * Calculates the net distance to the relevant following traffic participants
+     * @param in The input
+     * @param state The state
+     * @param param The parameters
+     * @param summary The target summary of the step
+     * @param laneChangeInt The intention to change the lane
+     * @param laneChangeFactor The progress factor of the lane change process
+     */
+    template<typename I, typename S, typename T>
+    void consciousFollow(const I &in, S &state, const BasicParameters<T> &param, const BasicTargetSummary<T> &summary,
+                         int laneChangeInt, T laneChangeFactor) {
+
+        // closest targets ahead on ego lane and on neighbouring lane
+        auto im = summary.leader(0);
+        auto im_loi = summary.leader(laneChangeInt);
+    
+        // instantiate distance, velocity, and factor
+        T ds = INFINITY, v = 0.0;
+        T factor = 1 - laneChangeFactor;
+
+        // closest ego lane target
+        if (im != agent_model::BasicTargetSummary<T>::NONE) {
+            auto &t = summary.target(im);
+            ds = t.ds - t.size.length * 0.5 - param.vehicle.size.length * 0.5 + param.vehicle.pos.x;
+            v = t.v;
+        }
+    
+        // save distance and velocity
+        state.conscious.follow.targets[0].distance = ds;
+        state.conscious.follow.targets[0].velocity = v;
+        state.conscious.follow.targets[0].factor = factor;
+    
+        // calculate if vehicle stands behind target vehicle
+        bool standing = in.vehicle.v < 1e-3 && v < 0.5 && ds <= param.follow.dsStopped + 1e-2;
+        state.conscious.follow.standing = standing;
+    
+        // reset distance, velocity, and factor for loi target
+        ds = INFINITY, v = 0.0;
+        factor = (laneChangeFactor > 0) ? 1.0 : 0.0;
+
+        // closest neigbouring lane target
+        if (im_loi != agent_model::BasicTargetSummary<T>::NONE) {
+            auto &t = summary.target(im_loi);
+            ds = t.ds - t.size.length * 0.5 - param.vehicle.size.length * 0.5 + param.vehicle.pos.x;
+            v = t.v;
+        }
+
+        // save distance and velocity
+        state.conscious.follow.targets[1].distance = ds;
+        state.conscious.follow.targets[1].velocity = v;
+        state.conscious.follow.targets[1].factor = factor;
+    }
+
+
+    /**
+     * Calculates the reaction to follow other traffic participants
+     * @param in The input
+     * @param state The state
+     * @param param The parameters
+     * @return The reaction value to follow
+     */
+    template<typename I, typename S, typename R>
+    R subconsciousFollow(const I &in, const S &state, const BasicParameters<R> &param) {
+
+        using namespace std;
+
+        R res = 0.0;
+        // get values
+        for (auto &t : state.conscious.follow.targets) {
+    
+            // ignore when distance is inf
+            if (isinf(t.distance))
+                continue;
+
+            R vT = t.velocity;
+            R ds = t.distance;
+            R v0 = state.conscious.velocity.local;
+            R s0 = param.follow.dsStopped;
+            R T = param.follow.timeHeadway;
+            R TMax = param.follow.thwMax;
+            R v = in.vehicle.v;
+
+            R v0T = std::max(R(10.0), v0);
+            R vTT = std::min(v0T, std::max(R(5.0), vT));
+
+            // calculate compensating time headway
+            R TT = (s0 + T * vTT - (T * vTT * sqrt(vTT * vTT + v0T * v0T) * sqrt(vTT + v0T) * sqrt(v0T - vTT)) / (v0T * v0T)) / vTT;
+            TT = max(R(0.0), min(T, TT));
+
+            // scale down factor
+            R f = agent_model::scaleInf<R>(ds, v0 * TMax, vT * T);
+            R fT = agent_model::scale<R>(vT, 5.0, 0.0);
+
+            // calculate reaction and multiply with target factor
+            res += t.factor * agent_model::IDMFollowReaction<R>(ds * f, vT, v, T - fT * TT, s0, param.velocity.a, param.velocity.b);
+        }
+        return res;
+    }
+
+
+    /**
+     * Calculates the reaction to stop the vehicle at the desired point
+     * @param in The input
+     * @param state The state
+     * @param param The parameters
+     * @return The reaction value to stop
+     */
+    template<typename I, typename S, typename R>
+    R subconsciousStop(const I &in, const S &state, const BasicParameters<R> &param) {
+
+        using namespace std;
+
+        // get states
+        R v = in.vehicle.v;
+        R ds = state.conscious.stop.ds;
+        R dsMax = state.conscious.stop.dsMax;
+
+        // get parameters
+        R s0 = 2.0; // never set to 0.0 (this value is used to give IDM parameter s0 a value, its compensated though)
+        R T = 1.2; // time headway (this is only to have a degressive behavior)
+        R a = param.velocity.a; // acceleration
+        R b = param.velocity.b; // deceleration
+
+        // abort, when out of range
+        if (ds > dsMax || isinf(dsMax))
+            return 0.0;
+
+        // apply s0
+        ds += s0;
+        dsMax += s0;
+
+        // distance scaling (to have a smooth transition from uninfluenced to stopping)
+        ds *= agent_model::scaleInf<R>(ds, dsMax, s0, 1.0);
+
+        // calculate reaction
+        return agent_model::IDMFollowReaction<R>(ds, 0.0, v, T, s0, a, b);
+
+    }
+
+
+    /**
+     * Calculates the reaction to reach the desired speed, including predictive control
+     * @param in The input
+     * @param state The state
+     * @param filter The speed reaction filter
+     * @return The reaction value to control speed
+     */
+    template<typename I, typename S, typename T>
+    T subconsciousSpeed(const I &in, const S &state, BasicFilter<T> &filter) {
+
+        // scale parameter
+        T deltaLoc = agent_model::scale<T>(state.conscious.velocity.local, 10.0, 2.0, 1.0) * 3.5 + 0.5;
+        T deltaPred = agent_model::scale<T>(state.conscious.velocity.prediction, 10.0, 2.0, 1.0) * 3.5 + 0.5;
+
+        // calculate reaction
+        T local = agent_model::IDMSpeedReaction<T>(in.vehicle.v, state.conscious.velocity.local, deltaLoc);
+        T pred = agent_model::IDMSpeedReaction<T>(in.vehicle.v, state.conscious.velocity.prediction, deltaPred);
+
+        // return
+        return filter.value(std::max(local, pred));
+
+    }
+
+
+    /**
+     * Calculates the pedal behavior when starting or stopping for sub-microscopic simulations
+     * @param state The state
+     * @param param The parameters
+     * @return The pedal value
+     */
+    template<typename S, typename T>
+    T subconsciousStartStop(const S &state, const BasicParameters<T> &param) {
+
+        // check for standing
+        return (state.conscious.stop.standing || state.conscious.follow.standing)
+               ? param.stop.pedalDuringStanding : T(INFINITY);
+
+    }
+
+
+} // namespace agent_model
+
+#endif // SIMDRIVER_LONGITUDINAL_STAGES_H
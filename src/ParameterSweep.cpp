@@ -0,0 +1,183 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// ParameterSweep.cpp
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "ParameterSweep.h"
+
+namespace agent_model {
+
+
+    std::vector<Parameters> ParameterSweep::grid(const Parameters &base, const std::vector<Axis> &axes) {
+
+        // calculate number of variants
+        size_t n = 1;
+        for (auto &axis : axes)
+            n *= axis.values.size();
+
+        std::vector<Parameters> variants(n, base);
+
+        // iterate over variants and set values (last axis changes fastest)
+        for (size_t k = 0; k < n; ++k) {
+
+            size_t r = k;
+            for (size_t j = axes.size(); j > 0; --j) {
+
+                auto &axis = axes[j - 1];
+                axis.set(variants[k], axis.values[r % axis.values.size()]);
+                r /= axis.values.size();
+
+            }
+        }
+
+        return variants;
+
+    }
+
+
+    void ParameterSweep::run(const Scenario &scenario, const Parameters *variants, size_t n,
+                             const SummaryFunction &summary, unsigned int threads) {
+
+        // get number of threads
+        if (threads == 0)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+
+        threads = (unsigned int) std::min((size_t) threads, n);
+
+        std::atomic<size_t> next{0};
+        std::mutex mutex;
+
+        // pulls the next variant until all variants are done
+        auto worker = [&](std::exception_ptr &error) {
+
+            try {
+
+                for (size_t k = next++; k < n; k = next++) {
+
+                    // fresh agent per variant (init() does not reset all states), so the result does not depend on
+                    // the variants run before on the same thread
+                    AgentModel agent;
+
+                    auto result = run(agent, scenario, variants[k]);
+                    result.variant = k;
+
+                    // stream result
+                    std::lock_guard<std::mutex> lock(mutex);
+                    summary(result);
+
+                }
+
+            } catch (...) {
+
+                error = std::current_exception();
+
+                // stop other workers
+                next = n;
+
+            }
+
+        };
+
+        // start threads
+        std::vector<std::exception_ptr> errors(threads, nullptr);
+        std::vector<std::thread> pool;
+        pool.reserve(threads);
+
+        for (unsigned int j = 0; j < threads; ++j)
+            pool.emplace_back(worker, std::ref(errors[j]));
+
+        // wait for threads
+        for (auto &th : pool)
+            th.join();
+
+        // forward the first error
+        for (auto &e : errors) {
+            if (e)
+                std::rethrow_exception(e);
+        }
+
+    }
+
+
+    ParameterSweep::Summary ParameterSweep::run(AgentModel &agent, const Scenario &scenario,
+                                                const Parameters &parameters) {
+
+        Summary result{0, 0, INFINITY, -INFINITY, 0.0, 0.0, 0.0, 0.0, INFINITY, 0.0};
+
+        if (scenario.steps == 0)
+            return result;
+
+        // set parameters and initial input and init the agent
+        *agent.getParameters() = parameters;
+        *agent.getInput() = scenario.inputs[0];
+        agent.init();
+
+        double sum = 0.0, sum2 = 0.0;
+        double aLast = NAN;
+
+        for (unsigned int i = 0; i < scenario.steps; ++i) {
+
+            // set input and step
+            *agent.getInput() = scenario.inputs[i];
+            agent.step(scenario.startTime + i * scenario.stepSize);
+
+            // get state
+            auto state = agent.getState();
+            double a = state->subconscious.a;
+
+            // update metrics
+            result.aMin = std::min(result.aMin, a);
+            result.aMax = std::max(result.aMax, a);
+            result.kappaMax = std::max(result.kappaMax, std::abs(state->subconscious.kappa));
+            result.followDistanceMin = std::min(result.followDistanceMin, state->conscious.follow.targets[0].distance);
+
+            if (!std::isnan(aLast))
+                result.jerkMax = std::max(result.jerkMax, std::abs(a - aLast) / scenario.stepSize);
+
+            if (state->conscious.stop.standing || state->conscious.follow.standing)
+                result.standingTime += scenario.stepSize;
+
+            sum += a;
+            sum2 += a * a;
+            aLast = a;
+
+        }
+
+        // calculate means
+        result.steps = scenario.steps;
+        result.aMean = sum / scenario.steps;
+        result.aRms = std::sqrt(sum2 / scenario.steps);
+
+        return result;
+
+    }
+
+
+}
@@ -0,0 +1,120 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// ParameterSweep.h
+
+
+#ifndef SIMDRIVER_PARAMETERSWEEP_H
+#define SIMDRIVER_PARAMETERSWEEP_H
+
+#include <functional>
+#include <vector>
+#include "AgentModel.h"
+
+namespace agent_model {
+
+
+    /**
+     * @brief A class to run a recorded scenario with many parameter variants in parallel
+     * All variants share the same read-only input recording. Every variant runs on a freshly constructed agent on the
+     * worker's stack, so the results do not depend on the number of threads or on the order of the variants. The
+     * summary of each run is streamed to a callback as soon as the run has finished.
+     */
+    class ParameterSweep {
+
+    public:
+
+        /** @brief A recorded scenario (open loop) */
+        struct Scenario {
+            const Input *inputs;  //!< The recorded inputs, one per step
+            unsigned int steps;   //!< The number of steps (number of recorded inputs)
+            double startTime;     //!< The simulation time of the first step (in *s*)
+            double stepSize;      //!< The step size (in *s*)
+        };
+
+        /** @brief The summary metrics of a single run */
+        struct Summary {
+            size_t variant;           //!< The index of the parameter variant
+            unsigned int steps;       //!< The number of steps performed
+            double aMin;              //!< The minimum desired acceleration (in *m/s^2*)
+            double aMax;              //!< The maximum desired acceleration (in *m/s^2*)
+            double aMean;             //!< The mean desired acceleration (in *m/s^2*)
+            double aRms;              //!< The root mean square of the desired acceleration (in *m/s^2*)
+            double jerkMax;           //!< The maximum absolute change rate of the desired acceleration (in *m/s^3*)
+            double kappaMax;          //!< The maximum absolute desired curvature (in *1/m*)
+            double followDistanceMin; //!< The minimum distance to the followed target (in *m*)
+            double standingTime;      //!< The time the driver wanted to stand still (in *s*)
+        };
+
+        /** @brief An axis of a parameter grid */
+        struct Axis {
+            std::function<void(Parameters &, double)> set; //!< Function to set the value to the parameters
+            std::vector<double> values;                    //!< The values of the axis
+        };
+
+        /**
+         * Function to receive the summary of a run. The function is called sequentially, but not in the order of the
+         * variants.
+         * @param summary The summary of the run
+         */
+        typedef std::function<void(const Summary &summary)> SummaryFunction;
+
+
+        /**
+         * Creates the full grid (cartesian product) of the given axes based on the given parameters
+         * @param base The base parameters
+         * @param axes The axes of the grid
+         * @return The parameter variants
+         */
+        static std::vector<Parameters> grid(const Parameters &base, const std::vector<Axis> &axes);
+
+
+        /**
+         * Runs the scenario for each parameter variant in parallel
+         * @param scenario The recorded scenario
+         * @param variants Array of parameter variants
+         * @param n Number of variants
+         * @param summary The function to receive the summary of each run
+         * @param threads Number of threads to be used (0: number of hardware threads)
+         */
+        static void run(const Scenario &scenario, const Parameters *variants, size_t n, const SummaryFunction &summary,
+                        unsigned int threads = 0);
+
+
+        /**
+         * Runs the scenario with the given agent and parameters and returns the summary
+         * The agent is only initialized by init(), which does not reset all states. For reproducible results, pass a
+         * freshly constructed agent.
+         * @param agent The agent to be used
+         * @param scenario The recorded scenario
+         * @param parameters The parameters
+         * @return The summary of the run
+         */
+        static Summary run(AgentModel &agent, const Scenario &scenario, const Parameters &parameters);
+
+    };
+
+
+}
+
+#endif // SIMDRIVER_PARAMETERSWEEP_H
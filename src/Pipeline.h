@@ -0,0 +1,287 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// Pipeline.h
+
+#ifndef SIMDRIVER_PIPELINE_H
+#define SIMDRIVER_PIPELINE_H
+
+#include <cstdint>
+#include "Interface.h"
+
+template<typename T>
+class BasicAgentModel;
+
+namespace agent_model {
+
+
+    /*!< The stages of the agent model in their order of execution. */
+    enum Stage {
+        STAGE_DECISION_LANE_CHANGE,
+        STAGE_DECISION_PROCESS_STOP,
+        STAGE_DECISION_LATERAL_OFFSET,
+        STAGE_CONSCIOUS_LANE_CHANGE,
+        STAGE_CONSCIOUS_VELOCITY,
+        STAGE_CONSCIOUS_STOP,
+        STAGE_CONSCIOUS_FOLLOW,
+        STAGE_CONSCIOUS_LATERAL_OFFSET,
+        STAGE_CONSCIOUS_REFERENCE_POINTS,
+        STAGE_SUBCONSCIOUS_SPEED,
+        STAGE_SUBCONSCIOUS_STOP,
+        STAGE_SUBCONSCIOUS_FOLLOW,
+        STAGE_SUBCONSCIOUS_START_STOP,
+        STAGE_SUBCONSCIOUS_LATERAL_CONTROL,
+        NUMBER_OF_STAGES
+    };
+
+
+    /*!< The first stages of the conscious and subconscious layers. */
+    static const unsigned int STAGE_FIRST_CONSCIOUS = STAGE_CONSCIOUS_LANE_CHANGE;
+    static const unsigned int STAGE_FIRST_SUBCONSCIOUS = STAGE_SUBCONSCIOUS_SPEED;
+
+
+    /*!< Groups of state fields, which are read and written by the stages (bit mask). */
+    enum StateGroup : uint32_t {
+        STATE_DECISIONS_LANE_CHANGE = 1u << 0,  //!< decisions.laneChangeInt, decisions.laneChangeDec
+        STATE_DECISIONS_LATERAL = 1u << 1,      //!< decisions.lateral
+        STATE_DECISIONS_STOPPING = 1u << 2,     //!< decisions.signal, target, destination, lane
+        STATE_CONSCIOUS_VELOCITY = 1u << 3,     //!< conscious.velocity
+        STATE_CONSCIOUS_STOP = 1u << 4,         //!< conscious.stop
+        STATE_CONSCIOUS_FOLLOW = 1u << 5,       //!< conscious.follow
+        STATE_CONSCIOUS_LATERAL = 1u << 6,      //!< conscious.lateral
+        STATE_SUBCONSCIOUS_A = 1u << 7,         //!< subconscious.a (via the speed, stop and follow reactions)
+        STATE_SUBCONSCIOUS_PEDAL = 1u << 8,     //!< subconscious.pedal
+        STATE_SUBCONSCIOUS_KAPPA = 1u << 9,     //!< subconscious.kappa
+        STATE_AUX = 1u << 10                    //!< aux
+    };
+
+
+    /*!< A class to describe the data flow of a stage. */
+    struct StageInfo {
+        const char *name;   //!< The name of the stage (the method of the agent model)
+        uint32_t reads;     //!< The state groups read by the stage
+        uint32_t writes;    //!< The state groups written by the stage
+    };
+
+
+    /*!< The data flow of the stages (indexed by stage). */
+    static constexpr StageInfo STAGES[NUMBER_OF_STAGES] = {
+            {"decisionLaneChange", 0, STATE_DECISIONS_LANE_CHANGE},
+            {"decisionProcessStop", STATE_CONSCIOUS_STOP, STATE_DECISIONS_STOPPING | STATE_CONSCIOUS_STOP},
+            {"decisionLateralOffset", 0, STATE_DECISIONS_LATERAL},
+            {"consciousLaneChange", STATE_DECISIONS_LANE_CHANGE, STATE_CONSCIOUS_LATERAL},
+            {"consciousVelocity", 0, STATE_CONSCIOUS_VELOCITY},
+            {"consciousStop", STATE_DECISIONS_STOPPING, STATE_CONSCIOUS_STOP},
+            {"consciousFollow", STATE_DECISIONS_LANE_CHANGE, STATE_CONSCIOUS_FOLLOW},
+            {"consciousLateralOffset", STATE_DECISIONS_LATERAL | STATE_CONSCIOUS_LATERAL, STATE_CONSCIOUS_LATERAL},
+            {"consciousReferencePoints", STATE_CONSCIOUS_LATERAL, STATE_CONSCIOUS_LATERAL},
+            {"subconsciousSpeed", STATE_CONSCIOUS_VELOCITY, STATE_SUBCONSCIOUS_A},
+            {"subconsciousStop", STATE_CONSCIOUS_STOP, STATE_SUBCONSCIOUS_A},
+            {"subconsciousFollow", STATE_CONSCIOUS_FOLLOW | STATE_CONSCIOUS_VELOCITY, STATE_SUBCONSCIOUS_A},
+            {"subconsciousStartStop", STATE_CONSCIOUS_FOLLOW | STATE_CONSCIOUS_STOP, STATE_SUBCONSCIOUS_PEDAL},
+            {"subconsciousLateralControl", STATE_CONSCIOUS_LATERAL | STATE_AUX, STATE_SUBCONSCIOUS_KAPPA | STATE_AUX}
+    };
+
+
+    /*!< The reactions of the subconscious stages, which are combined to the desired values. */
+    template<typename T>
+    struct BasicReactions {
+        T speed;   //!< The speed reaction
+        T stop;    //!< The stop reaction
+        T follow;  //!< The follow reaction
+        T pedal;   //!< The pedal value
+        T kappa;   //!< The curvature
+    };
+    typedef BasicReactions<double> Reactions;
+
+
+    /**
+     * @brief The configuration of the stages of an agent model
+     * Each stage can be enabled, disabled or replaced by a function. The agent model builds a dispatch list from the
+     * configuration at construction, so a step only calls the enabled stages without branching on the configuration.
+     * Disabled stages keep their state fields (and reactions) at their last values, i.e. the initial values if they
+     * are disabled from the start. A replacing function has access to the public interface of the model and writes
+     * its results to the state or, for subconscious stages, to the reactions.
+     * @tparam T The scalar type of the agent model
+     */
+    template<typename T>
+    class BasicPipeline {
+
+    public:
+
+        /** A function to replace a stage */
+        using Function = void (*)(::BasicAgentModel<T> &model, BasicReactions<T> &reactions, void *context);
+
+    protected:
+
+        bool _enabled[NUMBER_OF_STAGES]{};          //!< Flags whether the stages are enabled
+        Function _functions[NUMBER_OF_STAGES]{};    //!< The replacing functions (nullptr: built-in stage)
+        void *_contexts[NUMBER_OF_STAGES]{};        //!< The contexts passed to the replacing functions
+        bool _mobil = false;                        //!< Flag whether discretionary lane changes are decided by MOBIL
+
+    public:
+
+        /**
+         * Constructor. All stages are enabled.
+         */
+        BasicPipeline() {
+            for (auto &e : _enabled)
+                e = true;
+        }
+
+
+        /**
+         * Returns a pipeline for longitudinal-only studies (all lateral and lane change stages are disabled)
+         * @return The pipeline
+         */
+        static BasicPipeline longitudinal() {
+
+            BasicPipeline p;
+            p.disable(STAGE_DECISION_LANE_CHANGE);
+            p.disable(STAGE_DECISION_LATERAL_OFFSET);
+            p.disable(STAGE_CONSCIOUS_LANE_CHANGE);
+            p.disable(STAGE_CONSCIOUS_LATERAL_OFFSET);
+            p.disable(STAGE_CONSCIOUS_REFERENCE_POINTS);
+            p.disable(STAGE_SUBCONSCIOUS_LATERAL_CONTROL);
+
+            return p;
+
+        }
+
+
+        /**
+         * Enables or disables a stage
+         * @param stage The stage
+         * @param enabled Flag whether the stage is enabled
+         * @return This pipeline
+         */
+        BasicPipeline &enable(Stage stage, bool enabled = true) {
+            _enabled[stage] = enabled;
+            return *this;
+        }
+
+
+        /**
+         * Disables a stage
+         * @param stage The stage
+         * @return This pipeline
+         */
+        BasicPipeline &disable(Stage stage) {
+            return enable(stage, false);
+        }
+
+
+        /**
+         * Replaces a stage by a function (and enables it)
+         * @param stage The stage
+         * @param function The function (nullptr: built-in stage)
+         * @param context The context passed to the function
+         * @return This pipeline
+         */
+        BasicPipeline &replace(Stage stage, Function function, void *context = nullptr) {
+            _enabled[stage] = true;
+            _functions[stage] = function;
+            _contexts[stage] = context;
+            return *this;
+        }
+
+
+        /**
+         * Enables or disables discretionary lane changes in the lane change decision, which are decided by the MOBIL
+         * model for the neighbouring lanes and the lanes beyond, if no lane change is needed for the route (disabled by
+         * default)
+         * @param enabled Flag whether enabled
+         * @return This pipeline
+         */
+        BasicPipeline &mobil(bool enabled = true) {
+            _mobil = enabled;
+            return *this;
+        }
+
+
+        /**
+         * Returns whether discretionary lane changes are enabled
+         * @return Flag whether enabled
+         */
+        bool mobil() const {
+            return _mobil;
+        }
+
+
+        /**
+         * Returns whether a stage is enabled
+         * @param stage The stage
+         * @return Flag whether enabled
+         */
+        bool enabled(Stage stage) const {
+            return _enabled[stage];
+        }
+
+
+        /**
+         * Returns the replacing function of a stage
+         * @param stage The stage
+         * @return The function (nullptr: built-in stage)
+         */
+        Function function(Stage stage) const {
+            return _functions[stage];
+        }
+
+
+        /**
+         * Returns the context of the replacing function of a stage
+         * @param stage The stage
+         * @return The context
+         */
+        void *context(Stage stage) const {
+            return _contexts[stage];
+        }
+
+
+        /**
+         * Returns the state groups, which are read by an enabled stage but not written by any enabled stage. These
+         * fields keep their initial values.
+         * @return The state groups (bit mask)
+         */
+        uint32_t missing() const {
+
+            uint32_t reads = 0, writes = 0;
+            for (unsigned int i = 0; i < NUMBER_OF_STAGES; ++i) {
+                if (_enabled[i]) {
+                    reads |= STAGES[i].reads;
+                    writes |= STAGES[i].writes;
+                }
+            }
+
+            return reads & ~writes;
+
+        }
+
+    };
+
+    typedef BasicPipeline<double> Pipeline; //!< The pipeline of the agent model with double values
+
+
+}
+
+#endif // SIMDRIVER_PIPELINE_H
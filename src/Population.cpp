@@ -0,0 +1,228 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// Population.cpp
+//
+// Credits:
+// [1] Salmon, J. K., Moraes, M. A., Dror, R. O., & Shaw, D. E. (2011). Parallel random numbers: as easy as 1, 2, 3.
+//      Proceedings of the International Conference for High Performance Computing, Networking, Storage and Analysis.
+//      https://doi.org/10.1145/2063384.2063405
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+#include "Population.h"
+
+namespace agent_model {
+
+
+    /**
+     * The Philox4x32-10 counter-based random number generator [1]
+     * @param ctr The counter (will be replaced by the result)
+     * @param key The key
+     */
+    static void philox(uint32_t ctr[4], const uint32_t key[2]) {
+
+        const uint32_t M0 = 0xD2511F53, M1 = 0xCD9E8D57;
+        const uint32_t W0 = 0x9E3779B9, W1 = 0xBB67AE85;
+
+        uint32_t k0 = key[0], k1 = key[1];
+
+        for (unsigned int r = 0; r < 10; ++r) {
+
+            uint64_t p0 = (uint64_t) M0 * ctr[0];
+            uint64_t p1 = (uint64_t) M1 * ctr[2];
+
+            uint32_t c0 = (uint32_t) (p1 >> 32) ^ ctr[1] ^ k0;
+            uint32_t c1 = (uint32_t) p1;
+            uint32_t c2 = (uint32_t) (p0 >> 32) ^ ctr[3] ^ k1;
+            uint32_t c3 = (uint32_t) p0;
+
+            ctr[0] = c0; ctr[1] = c1; ctr[2] = c2; ctr[3] = c3;
+
+            k0 += W0;
+            k1 += W1;
+
+        }
+
+    }
+
+
+    Population::Population(uint64_t seed) : _seed(seed) {}
+
+
+    unsigned int Population::addVariable(size_t offset, const Distribution &distribution) {
+
+        if (_n == NOV)
+            throw std::invalid_argument("number of varied parameters must not exceed NOV.");
+        else if (offset + sizeof(double) > sizeof(Parameters))
+            throw std::invalid_argument("offset must be within the parameters.");
+
+        // add variable, uncorrelated to the others
+        _offsets[_n] = offset;
+        _dists[_n] = distribution;
+        _corr[_n][_n] = 1.0;
+
+        _n++;
+        decompose();
+
+        return _n - 1;
+
+    }
+
+
+    void Population::setCorrelation(unsigned int i, unsigned int j, double rho) {
+
+        if (i >= _n || j >= _n || i == j)
+            throw std::invalid_argument("correlation must be defined between two existing variables.");
+        else if (rho < -1.0 || rho > 1.0)
+            throw std::invalid_argument("correlation coefficient must be in [-1, 1].");
+
+        double old = _corr[i][j];
+
+        _corr[i][j] = rho;
+        _corr[j][i] = rho;
+
+        // reset correlation if the matrix is not valid
+        try {
+            decompose();
+        } catch (...) {
+            _corr[i][j] = old;
+            _corr[j][i] = old;
+            decompose();
+            throw;
+        }
+
+    }
+
+
+    void Population::generate(const Parameters &base, uint64_t id, Parameters &parameters) const {
+
+        parameters = base;
+
+        // draw independent standard normal variables
+        double u[NOV];
+        for (unsigned int i = 0; i < _n; ++i)
+            u[i] = normal(_seed, id, i);
+
+        for (unsigned int i = 0; i < _n; ++i) {
+
+            // correlate
+            double z = 0.0;
+            for (unsigned int j = 0; j <= i; ++j)
+                z += _chol[i][j] * u[j];
+
+            // transform to the distribution
+            auto &d = _dists[i];
+            double x;
+
+            switch (d.type) {
+                case DIST_CONSTANT:
+                    x = d.a;
+                    break;
+                case DIST_UNIFORM:
+                    x = d.a + (d.b - d.a) * 0.5 * std::erfc(-z / std::sqrt(2.0));
+                    break;
+                case DIST_NORMAL:
+                    x = d.a + d.b * z;
+                    break;
+                case DIST_LOGNORMAL:
+                    x = std::exp(d.a + d.b * z);
+                    break;
+                default:
+                    throw std::invalid_argument("distribution type is unknown.");
+            }
+
+            // limit value
+            x = std::max(d.min, std::min(d.max, x));
+
+            // write value
+            std::memcpy((char *) &parameters + _offsets[i], &x, sizeof(double));
+
+        }
+
+    }
+
+
+    void Population::generate(const Parameters &base, const uint64_t *ids, AgentModel *agents, size_t n) const {
+
+        for (size_t k = 0; k < n; ++k)
+            generate(base, ids[k], *agents[k].getParameters());
+
+    }
+
+
+    double Population::uniform(uint64_t seed, uint64_t id, uint64_t counter) {
+
+        uint32_t key[2] = {(uint32_t) seed, (uint32_t) (seed >> 32)};
+        uint32_t ctr[4] = {(uint32_t) id, (uint32_t) (id >> 32), (uint32_t) counter, (uint32_t) (counter >> 32)};
+
+        philox(ctr, key);
+
+        // 53 bit mantissa, shifted by half a step to exclude 0 and 1
+        uint64_t r = ((uint64_t) ctr[0] << 32 | ctr[1]) >> 11;
+        return ((double) r + 0.5) / 9007199254740992.0;
+
+    }
+
+
+    double Population::normal(uint64_t seed, uint64_t id, uint64_t counter) {
+
+        // Box-Muller transform with two independent uniform numbers
+        double u0 = uniform(seed, id, 2 * counter);
+        double u1 = uniform(seed, id, 2 * counter + 1);
+
+        return std::sqrt(-2.0 * std::log(u0)) * std::cos(2.0 * 3.14159265358979323846 * u1);
+
+    }
+
+
+    void Population::decompose() {
+
+        // Cholesky-Banachiewicz
+        for (unsigned int i = 0; i < _n; ++i) {
+            for (unsigned int j = 0; j <= i; ++j) {
+
+                double sum = _corr[i][j];
+                for (unsigned int k = 0; k < j; ++k)
+                    sum -= _chol[i][k] * _chol[j][k];
+
+                if (i != j) {
+                    _chol[i][j] = sum / _chol[j][j];
+                    continue;
+                }
+
+                if (sum <= 0.0)
+                    throw std::invalid_argument("correlation matrix must be positive definite.");
+
+                _chol[i][i] = std::sqrt(sum);
+
+            }
+        }
+
+    }
+
+
+}
@@ -0,0 +1,154 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// Population.h
+
+
+#ifndef SIMDRIVER_POPULATION_H
+#define SIMDRIVER_POPULATION_H
+
+#include <cstdint>
+#include <cstddef>
+#include "AgentModel.h"
+
+namespace agent_model {
+
+
+    /*!< This enum describes the type of a parameter distribution. */
+    enum DistributionType { DIST_CONSTANT, DIST_UNIFORM, DIST_NORMAL, DIST_LOGNORMAL };
+
+
+    /*!< A class to store a parameter distribution. */
+    struct Distribution {
+        DistributionType type; //!< The type of the distribution
+        double a; //!< Value (constant), lower bound (uniform), mean (normal) or mean of the logarithm (log-normal)
+        double b; //!< Upper bound (uniform), standard deviation (normal) or standard deviation of the logarithm (log-normal)
+        double min; //!< Lower limit of the drawn value (-inf: not limited)
+        double max; //!< Upper limit of the drawn value (inf: not limited)
+    };
+
+
+    /**
+     * @brief A generator for populations of driver parameters
+     * The parameters are drawn from configurable distributions. Correlations between the parameters are modelled by a
+     * Gaussian copula. The random numbers are generated by a counter-based generator (Philox4x32-10) keyed by the
+     * seed and the agent ID, so the parameters of an agent do not depend on the number of threads or the order in
+     * which the agents are generated. The generator doesn't allocate memory.
+     */
+    class Population {
+
+    public:
+
+        static const unsigned int NOV = 32; //!< Maximum number of varied parameters
+
+    protected:
+
+        uint64_t _seed = 0;           //!< The seed of the population
+        unsigned int _n = 0;          //!< The number of varied parameters
+        size_t _offsets[NOV]{};       //!< The byte offsets of the parameters within agent_model::Parameters
+        Distribution _dists[NOV]{};   //!< The distributions of the parameters
+        double _corr[NOV][NOV]{};     //!< The correlation matrix
+        double _chol[NOV][NOV]{};     //!< The Cholesky factor of the correlation matrix
+
+
+    public:
+
+        /**
+         * Constructor
+         * @param seed The seed of the population
+         */
+        explicit Population(uint64_t seed = 0);
+
+
+        /**
+         * Adds a parameter to be varied
+         * @param offset The byte offset of the parameter (double) in agent_model::Parameters, e.g.
+         *               offsetof(agent_model::Parameters, follow.timeHeadway)
+         * @param distribution The distribution of the parameter
+         * @return The index of the variable
+         */
+        unsigned int addVariable(size_t offset, const Distribution &distribution);
+
+
+        /**
+         * Sets the correlation between two variables
+         * The correlation is defined between the underlying standard normal variables.
+         * @param i Index of the first variable
+         * @param j Index of the second variable
+         * @param rho Correlation coefficient [-1..1]
+         */
+        void setCorrelation(unsigned int i, unsigned int j, double rho);
+
+
+        /**
+         * Draws the parameters of a single agent
+         * @param base The base parameters (for all parameters, which are not varied)
+         * @param id The ID of the agent
+         * @param parameters The parameters to be written
+         */
+        void generate(const Parameters &base, uint64_t id, Parameters &parameters) const;
+
+
+        /**
+         * Draws the parameters for a batch of agents
+         * @param base The base parameters (for all parameters, which are not varied)
+         * @param ids The IDs of the agents
+         * @param agents The agents to be parameterized
+         * @param n The number of agents
+         */
+        void generate(const Parameters &base, const uint64_t *ids, AgentModel *agents, size_t n) const;
+
+
+        /**
+         * Returns a uniformly distributed random number in (0, 1)
+         * @param seed The seed
+         * @param id The ID of the agent
+         * @param counter The counter of the random number
+         * @return The random number
+         */
+        static double uniform(uint64_t seed, uint64_t id, uint64_t counter);
+
+
+        /**
+         * Returns a standard normal distributed random number
+         * @param seed The seed
+         * @param id The ID of the agent
+         * @param counter The counter of the random number
+         * @return The random number
+         */
+        static double normal(uint64_t seed, uint64_t id, uint64_t counter);
+
+
+    protected:
+
+        /**
+         * Updates the Cholesky factor of the correlation matrix
+         */
+        void decompose();
+
+    };
+
+
+}
+
+#endif // SIMDRIVER_POPULATION_H
@@ -0,0 +1,278 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// Reflection.cpp
+
+
+#include <cstring>
+#include <stdexcept>
+#include "Reflection.h"
+
+namespace agent_model {
+namespace reflection {
+
+
+    // definitions of the field tables
+    constexpr Field FieldTable<Position>::fields[];
+    constexpr Field FieldTable<DynamicPosition>::fields[];
+    constexpr Field FieldTable<Point>::fields[];
+    constexpr Field FieldTable<Dimensions>::fields[];
+    constexpr Field FieldTable<VehicleState>::fields[];
+    constexpr Field FieldTable<Horizon>::fields[];
+    constexpr Field FieldTable<Lane>::fields[];
+    constexpr Field FieldTable<ControlPath>::fields[];
+    constexpr Field FieldTable<FollowTarget>::fields[];
+    constexpr Field FieldTable<Signal>::fields[];
+    constexpr Field FieldTable<Target>::fields[];
+    constexpr Field FieldTable<DecisionStopping>::fields[];
+    constexpr Field FieldTable<Decisions>::fields[];
+    constexpr Field FieldTable<ConsciousVelocity>::fields[];
+    constexpr Field FieldTable<ConsciousStop>::fields[];
+    constexpr Field FieldTable<ConsciousFollow>::fields[];
+    constexpr Field FieldTable<ConsciousLateral>::fields[];
+    constexpr Field FieldTable<Conscious>::fields[];
+    constexpr Field FieldTable<Subconscious>::fields[];
+    constexpr Field FieldTable<MemoryVehicle>::fields[];
+    constexpr Field FieldTable<MemoryLateral>::fields[];
+    constexpr Field FieldTable<MemoryLaneChange>::fields[];
+    constexpr Field FieldTable<ParameterVelocityControl>::fields[];
+    constexpr Field FieldTable<ParameterFollowing>::fields[];
+    constexpr Field FieldTable<ParameterVehicle>::fields[];
+    constexpr Field FieldTable<ParameterSteering>::fields[];
+    constexpr Field FieldTable<ParameterStopping>::fields[];
+    constexpr Field FieldTable<ParameterLaneChange>::fields[];
+    constexpr Field FieldTable<Input>::fields[];
+    constexpr Field FieldTable<State>::fields[];
+    constexpr Field FieldTable<Memory>::fields[];
+    constexpr Field FieldTable<Parameters>::fields[];
+
+
+    Resolved resolve(const Field *fields, unsigned int count, const std::string &path) {
+
+        Resolved res{0, 0, nullptr, true};
+        size_t pos = 0;
+
+        while (true) {
+
+            if (fields == nullptr)
+                throw std::invalid_argument("path \"" + path + "\" addresses a member of a plain value.");
+
+            // get name of member
+            auto end = path.find_first_of(".[", pos);
+            auto name = path.substr(pos, end == std::string::npos ? std::string::npos : end - pos);
+
+            // find member
+            const Field *field = nullptr;
+            for (unsigned int i = 0; i < count; ++i) {
+                if (name == fields[i].name) {
+                    field = &fields[i];
+                    break;
+                }
+            }
+
+            if (field == nullptr)
+                throw std::invalid_argument("path \"" + path + "\" contains the unknown member \"" + name + "\".");
+
+            res.offset += field->offset;
+            res.size = field->size * field->extent;
+            res.field = field;
+            res.element = field->extent == 1;
+
+            // get index
+            if (end != std::string::npos && path[end] == '[') {
+
+                auto close = path.find(']', end);
+                if (close == std::string::npos || close == end + 1)
+                    throw std::invalid_argument("path \"" + path + "\" contains an invalid index.");
+
+                auto index = path.substr(end + 1, close - end - 1);
+                if (index.find_first_not_of("0123456789") != std::string::npos)
+                    throw std::invalid_argument("path \"" + path + "\" contains an invalid index.");
+
+                auto i = std::stoul(index);
+                if (field->extent == 1 || i >= field->extent)
+                    throw std::invalid_argument("path \"" + path + "\" contains an index out of range.");
+
+                res.offset += i * field->size;
+                res.size = field->size;
+                res.element = true;
+
+                end = close + 1;
+
+            }
+
+            // last member
+            if (end == std::string::npos || end == path.size())
+                return res;
+
+            // next member
+            if (path[end] != '.' || !res.element)
+                throw std::invalid_argument("path \"" + path + "\" is malformed.");
+
+            pos = end + 1;
+            count = field->count;
+            fields = field->fields;
+
+        }
+
+    }
+
+
+    double toDouble(const Field &field, const void *value) {
+
+        switch (field.type) {
+            case FIELD_DOUBLE: {
+                double v;
+                std::memcpy(&v, value, sizeof(double));
+                return v;
+            }
+            case FIELD_INT: {
+                int v;
+                std::memcpy(&v, value, sizeof(int));
+                return v;
+            }
+            case FIELD_UINT: {
+                unsigned int v;
+                std::memcpy(&v, value, sizeof(unsigned int));
+                return v;
+            }
+            case FIELD_BOOL: {
+                bool v;
+                std::memcpy(&v, value, sizeof(bool));
+                return v ? 1.0 : 0.0;
+            }
+            case FIELD_ENUM: {
+                int v;
+                std::memcpy(&v, value, sizeof(int));
+                return v;
+            }
+            default:
+                throw std::invalid_argument("field is not a plain value.");
+        }
+
+    }
+
+
+    /**
+     * Walks the plain values of two structs in parallel (b may be nullptr)
+     */
+    static void walk(const Field *fields, unsigned int count, const char *a, const char *b, std::string &path,
+                     const std::function<void(const Field &, const void *, const void *)> &fnc) {
+
+        auto length = path.size();
+
+        for (unsigned int i = 0; i < count; ++i) {
+
+            auto &f = fields[i];
+
+            for (unsigned int j = 0; j < f.extent; ++j) {
+
+                // create name
+                path.resize(length);
+                if (length != 0)
+                    path += '.';
+
+                path += f.name;
+                if (f.extent != 1)
+                    path += "[" + std::to_string(j) + "]";
+
+                auto offset = f.offset + j * f.size;
+                auto pa = a + offset;
+                auto pb = b == nullptr ? nullptr : b + offset;
+
+                if (f.type == FIELD_STRUCT)
+                    walk(f.fields, f.count, pa, pb, path, fnc);
+                else
+                    fnc(f, pa, pb);
+
+            }
+
+        }
+
+        path.resize(length);
+
+    }
+
+
+    void visit(const Field *fields, unsigned int count, const void *data, const VisitFunction &fnc) {
+
+        std::string path;
+        walk(fields, count, (const char *) data, nullptr, path,
+             [&path, &fnc](const Field &f, const void *a, const void *) { fnc(path, f, a); });
+
+    }
+
+
+    size_t diff(const Field *fields, unsigned int count, const void *a, const void *b, const DiffFunction &fnc) {
+
+        size_t n = 0;
+        std::string path;
+        walk(fields, count, (const char *) a, (const char *) b, path,
+             [&path, &fnc, &n](const Field &f, const void *va, const void *vb) {
+
+                 // compare plain values bytewise (no padding inside plain values)
+                 if (std::memcmp(va, vb, f.size) == 0)
+                     return;
+
+                 ++n;
+                 if (fnc)
+                     fnc(path, f, va, vb);
+
+             });
+
+        return n;
+
+    }
+
+
+    uint64_t layoutHash(const Field *fields, unsigned int count, uint64_t seed) {
+
+        // FNV-1a
+        auto add = [&seed](const void *data, size_t size) {
+            auto bytes = static_cast<const unsigned char *>(data);
+            for (size_t i = 0; i < size; ++i) {
+                seed ^= bytes[i];
+                seed *= 1099511628211ULL;
+            }
+        };
+
+        for (unsigned int i = 0; i < count; ++i) {
+
+            auto &f = fields[i];
+            uint64_t values[] = {f.offset, (uint64_t) f.type, f.size, f.extent};
+
+            add(f.name, std::strlen(f.name) + 1);
+            add(values, sizeof(values));
+
+            if (f.type == FIELD_STRUCT)
+                seed = layoutHash(f.fields, f.count, seed);
+
+        }
+
+        return seed;
+
+    }
+
+
+} // namespace reflection
+} // namespace agent_model
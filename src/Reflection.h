@@ -0,0 +1,666 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// Reflection.h
+
+
+#ifndef SIMDRIVER_REFLECTION_H
+#define SIMDRIVER_REFLECTION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include "Interface.h"
+
+/**
+ * Defines a field entry for a member (or an array of members), struct members refer to the table of their type
+ */
+#define AGENT_MODEL_FIELD(S, m) makeField<decltype(S::m)>(#m, offsetof(S, m))
+
+/**
+ * Checks that the field table of a struct covers all members
+ */
+#define AGENT_MODEL_CHECK_TABLE(S) \
+    static_assert(covers(FieldTable<S>::fields, FieldTable<S>::count, sizeof(S), alignof(S)), \
+                  "field table of " #S " does not cover all members.");
+
+namespace agent_model {
+
+    /**
+     * @brief Field tables describing the memory layout of the interface structs
+     * Each table lists the members of a struct in declaration order with name, byte offset, type, element size and
+     * number of elements. Struct members refer to the table of the struct. The tables are generated at compile time
+     * from the struct definitions, so the offsets cannot drift from the actual layout, and a static check fails if
+     * a member is missing in a table. The tables are the single description of the interface used for injection,
+     * recording, serialization and comparison.
+     */
+    namespace reflection {
+
+        /** The type of a field */
+        enum FieldType { FIELD_STRUCT, FIELD_DOUBLE, FIELD_INT, FIELD_UINT, FIELD_BOOL, FIELD_ENUM };
+
+
+        /**
+         * @brief A field of a struct
+         */
+        struct Field {
+            const char *name;     //!< The name of the member
+            size_t offset;        //!< The byte offset of the member in the struct
+            FieldType type;       //!< The type of an element
+            size_t size;          //!< The size of an element (in *bytes*)
+            unsigned int extent;  //!< The number of elements (1 for non-array members)
+            const Field *fields;  //!< The field table of the element type (structs only)
+            unsigned int count;   //!< The number of entries in the field table
+        };
+
+
+        /**
+         * @brief A field resolved by a path
+         */
+        struct Resolved {
+            size_t offset;        //!< The byte offset relative to the root struct
+            size_t size;          //!< The size of the addressed value (in *bytes*)
+            const Field *field;   //!< The addressed field
+            bool element;         //!< Flag whether a single element is addressed (false for a whole array)
+        };
+
+
+        /** Maps a member type to the field type */
+        template<typename T>
+        struct FieldTypeOf {
+            static constexpr FieldType value = std::is_enum<T>::value ? FIELD_ENUM : FIELD_STRUCT;
+        };
+
+        template<> struct FieldTypeOf<double> { static constexpr FieldType value = FIELD_DOUBLE; };
+        template<> struct FieldTypeOf<int> { static constexpr FieldType value = FIELD_INT; };
+        template<> struct FieldTypeOf<unsigned int> { static constexpr FieldType value = FIELD_UINT; };
+        template<> struct FieldTypeOf<bool> { static constexpr FieldType value = FIELD_BOOL; };
+
+
+        /**
+         * @brief The field table of a struct (plain types have no table)
+         */
+        template<typename T>
+        struct FieldTable {
+            static constexpr const Field *fields = nullptr;
+            static constexpr unsigned int count = 0;
+        };
+
+
+        /**
+         * Creates a field entry for a member of type T
+         * @param name Name of the member
+         * @param offset Byte offset of the member
+         * @return The field entry
+         */
+        template<typename T>
+        constexpr Field makeField(const char *name, size_t offset) {
+
+            using E = typename std::remove_all_extents<T>::type;
+            return Field{name, offset, FieldTypeOf<E>::value, sizeof(E), (unsigned int) (sizeof(T) / sizeof(E)),
+                         FieldTable<E>::fields, FieldTable<E>::count};
+
+        }
+
+
+        /**
+         * Checks whether the field table covers all members of a struct, i.e. no gap between the members (or after
+         * the last member) is larger than the padding required for the alignment
+         * @param fields Field table
+         * @param count Number of entries in the field table
+         * @param size Size of the struct
+         * @param align Alignment of the struct
+         * @return Flag whether the table covers the struct
+         */
+        constexpr bool covers(const Field *fields, unsigned int count, size_t size, size_t align) {
+
+            size_t end = 0;
+            for (unsigned int i = 0; i < count; ++i) {
+
+                auto gap = fields[i].offset - end;
+                if (fields[i].offset < end || gap >= fields[i].size || gap >= alignof(double))
+                    return false;
+
+                end = fields[i].offset + fields[i].size * fields[i].extent;
+
+            }
+
+            return end <= size && size - end < align;
+
+        }
+
+
+        template<>
+        struct FieldTable<Position> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(Position, x),
+                    AGENT_MODEL_FIELD(Position, y)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(Position)
+
+        template<>
+        struct FieldTable<DynamicPosition> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(DynamicPosition, x),
+                    AGENT_MODEL_FIELD(DynamicPosition, y),
+                    AGENT_MODEL_FIELD(DynamicPosition, dx),
+                    AGENT_MODEL_FIELD(DynamicPosition, dy)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(DynamicPosition)
+
+        template<>
+        struct FieldTable<Point> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(Point, distance),
+                    AGENT_MODEL_FIELD(Point, time),
+                    AGENT_MODEL_FIELD(Point, value)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(Point)
+
+        template<>
+        struct FieldTable<Dimensions> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(Dimensions, width),
+                    AGENT_MODEL_FIELD(Dimensions, length)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(Dimensions)
+
+        template<>
+        struct FieldTable<VehicleState> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(VehicleState, v),
+                    AGENT_MODEL_FIELD(VehicleState, a),
+                    AGENT_MODEL_FIELD(VehicleState, psi),
+                    AGENT_MODEL_FIELD(VehicleState, dPsi),
+                    AGENT_MODEL_FIELD(VehicleState, s),
+                    AGENT_MODEL_FIELD(VehicleState, d),
+                    AGENT_MODEL_FIELD(VehicleState, pedal),
+                    AGENT_MODEL_FIELD(VehicleState, steering),
+                    AGENT_MODEL_FIELD(VehicleState, maneuver),
+                    AGENT_MODEL_FIELD(VehicleState, dsIntersection)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(VehicleState)
+
+        template<>
+        struct FieldTable<Horizon> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(Horizon, ds),
+                    AGENT_MODEL_FIELD(Horizon, x),
+                    AGENT_MODEL_FIELD(Horizon, y),
+                    AGENT_MODEL_FIELD(Horizon, psi),
+                    AGENT_MODEL_FIELD(Horizon, kappa),
+                    AGENT_MODEL_FIELD(Horizon, egoLaneWidth),
+                    AGENT_MODEL_FIELD(Horizon, rightLaneOffset),
+                    AGENT_MODEL_FIELD(Horizon, leftLaneOffset),
+                    AGENT_MODEL_FIELD(Horizon, destinationPoint)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(Horizon)
+
+        template<>
+        struct FieldTable<Lane> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(Lane, id),
+                    AGENT_MODEL_FIELD(Lane, width),
+                    AGENT_MODEL_FIELD(Lane, route),
+                    AGENT_MODEL_FIELD(Lane, closed),
+                    AGENT_MODEL_FIELD(Lane, dir),
+                    AGENT_MODEL_FIELD(Lane, access),
+                    AGENT_MODEL_FIELD(Lane, lane_change)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(Lane)
+
+        template<>
+        struct FieldTable<ControlPath> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(ControlPath, offset),
+                    AGENT_MODEL_FIELD(ControlPath, factor),
+                    AGENT_MODEL_FIELD(ControlPath, refPoints)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(ControlPath)
+
+        template<>
+        struct FieldTable<FollowTarget> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(FollowTarget, factor),
+                    AGENT_MODEL_FIELD(FollowTarget, lane),
+                    AGENT_MODEL_FIELD(FollowTarget, distance),
+                    AGENT_MODEL_FIELD(FollowTarget, velocity)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(FollowTarget)
+
+        template<>
+        struct FieldTable<Signal> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(Signal, id),
+                    AGENT_MODEL_FIELD(Signal, ds),
+                    AGENT_MODEL_FIELD(Signal, type),
+                    AGENT_MODEL_FIELD(Signal, value),
+                    AGENT_MODEL_FIELD(Signal, color),
+                    AGENT_MODEL_FIELD(Signal, icon),
+                    AGENT_MODEL_FIELD(Signal, subsignal),
+                    AGENT_MODEL_FIELD(Signal, sign_is_in_use)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(Signal)
+
+        template<>
+        struct FieldTable<Target> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(Target, id),
+                    AGENT_MODEL_FIELD(Target, ds),
+                    AGENT_MODEL_FIELD(Target, xy),
+                    AGENT_MODEL_FIELD(Target, v),
+                    AGENT_MODEL_FIELD(Target, a),
+                    AGENT_MODEL_FIELD(Target, d),
+                    AGENT_MODEL_FIELD(Target, psi),
+                    AGENT_MODEL_FIELD(Target, lane),
+                    AGENT_MODEL_FIELD(Target, size),
+                    AGENT_MODEL_FIELD(Target, dsIntersection),
+                    AGENT_MODEL_FIELD(Target, priority),
+                    AGENT_MODEL_FIELD(Target, position)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(Target)
+
+        template<>
+        struct FieldTable<DecisionStopping> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(DecisionStopping, id),
+                    AGENT_MODEL_FIELD(DecisionStopping, position),
+                    AGENT_MODEL_FIELD(DecisionStopping, standingTime)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(DecisionStopping)
+
+        template<>
+        struct FieldTable<Decisions> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(Decisions, laneChangeInt),
+                    AGENT_MODEL_FIELD(Decisions, laneChangeDec),
+                    AGENT_MODEL_FIELD(Decisions, lateral),
+                    AGENT_MODEL_FIELD(Decisions, signal),
+                    AGENT_MODEL_FIELD(Decisions, target),
+                    AGENT_MODEL_FIELD(Decisions, destination),
+                    AGENT_MODEL_FIELD(Decisions, lane)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(Decisions)
+
+        template<>
+        struct FieldTable<ConsciousVelocity> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(ConsciousVelocity, local),
+                    AGENT_MODEL_FIELD(ConsciousVelocity, prediction)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(ConsciousVelocity)
+
+        template<>
+        struct FieldTable<ConsciousStop> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(ConsciousStop, ds),
+                    AGENT_MODEL_FIELD(ConsciousStop, dsMax),
+                    AGENT_MODEL_FIELD(ConsciousStop, standing),
+                    AGENT_MODEL_FIELD(ConsciousStop, priority),
+                    AGENT_MODEL_FIELD(ConsciousStop, give_way)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(ConsciousStop)
+
+        template<>
+        struct FieldTable<ConsciousFollow> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(ConsciousFollow, targets),
+                    AGENT_MODEL_FIELD(ConsciousFollow, standing)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(ConsciousFollow)
+
+        template<>
+        struct FieldTable<ConsciousLateral> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(ConsciousLateral, paths)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(ConsciousLateral)
+
+        template<>
+        struct FieldTable<Conscious> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(Conscious, velocity),
+                    AGENT_MODEL_FIELD(Conscious, stop),
+                    AGENT_MODEL_FIELD(Conscious, follow),
+                    AGENT_MODEL_FIELD(Conscious, lateral)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(Conscious)
+
+        template<>
+        struct FieldTable<Subconscious> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(Subconscious, a),
+                    AGENT_MODEL_FIELD(Subconscious, dPsi),
+                    AGENT_MODEL_FIELD(Subconscious, kappa),
+                    AGENT_MODEL_FIELD(Subconscious, pedal),
+                    AGENT_MODEL_FIELD(Subconscious, steering)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(Subconscious)
+
+        template<>
+        struct FieldTable<MemoryVehicle> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(MemoryVehicle, s)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(MemoryVehicle)
+
+        template<>
+        struct FieldTable<MemoryLateral> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(MemoryLateral, time),
+                    AGENT_MODEL_FIELD(MemoryLateral, startTime),
+                    AGENT_MODEL_FIELD(MemoryLateral, distance),
+                    AGENT_MODEL_FIELD(MemoryLateral, startDistance),
+                    AGENT_MODEL_FIELD(MemoryLateral, offset)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(MemoryLateral)
+
+        template<>
+        struct FieldTable<MemoryLaneChange> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(MemoryLaneChange, switchLane),
+                    AGENT_MODEL_FIELD(MemoryLaneChange, decision),
+                    AGENT_MODEL_FIELD(MemoryLaneChange, startTime)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(MemoryLaneChange)
+
+        template<>
+        struct FieldTable<ParameterVelocityControl> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(ParameterVelocityControl, thwMax),
+                    AGENT_MODEL_FIELD(ParameterVelocityControl, delta),
+                    AGENT_MODEL_FIELD(ParameterVelocityControl, deltaPred),
+                    AGENT_MODEL_FIELD(ParameterVelocityControl, a),
+                    AGENT_MODEL_FIELD(ParameterVelocityControl, b),
+                    AGENT_MODEL_FIELD(ParameterVelocityControl, vScale),
+                    AGENT_MODEL_FIELD(ParameterVelocityControl, ayMax),
+                    AGENT_MODEL_FIELD(ParameterVelocityControl, vComfort)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(ParameterVelocityControl)
+
+        template<>
+        struct FieldTable<ParameterFollowing> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(ParameterFollowing, timeHeadway),
+                    AGENT_MODEL_FIELD(ParameterFollowing, dsStopped),
+                    AGENT_MODEL_FIELD(ParameterFollowing, thwMax)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(ParameterFollowing)
+
+        template<>
+        struct FieldTable<ParameterVehicle> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(ParameterVehicle, size),
+                    AGENT_MODEL_FIELD(ParameterVehicle, pos)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(ParameterVehicle)
+
+        template<>
+        struct FieldTable<ParameterSteering> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(ParameterSteering, thw),
+                    AGENT_MODEL_FIELD(ParameterSteering, dsMin),
+                    AGENT_MODEL_FIELD(ParameterSteering, P),
+                    AGENT_MODEL_FIELD(ParameterSteering, D)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(ParameterSteering)
+
+        template<>
+        struct FieldTable<ParameterStopping> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(ParameterStopping, dsGap),
+                    AGENT_MODEL_FIELD(ParameterStopping, TMax),
+                    AGENT_MODEL_FIELD(ParameterStopping, dsMax),
+                    AGENT_MODEL_FIELD(ParameterStopping, T),
+                    AGENT_MODEL_FIELD(ParameterStopping, tSign),
+                    AGENT_MODEL_FIELD(ParameterStopping, vStopped),
+                    AGENT_MODEL_FIELD(ParameterStopping, pedalDuringStanding)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(ParameterStopping)
+
+        template<>
+        struct FieldTable<ParameterLaneChange> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(ParameterLaneChange, bSafe),
+                    AGENT_MODEL_FIELD(ParameterLaneChange, aThreshold),
+                    AGENT_MODEL_FIELD(ParameterLaneChange, politenessFactor),
+                    AGENT_MODEL_FIELD(ParameterLaneChange, time)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(ParameterLaneChange)
+
+        template<>
+        struct FieldTable<Input> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(Input, vehicle),
+                    AGENT_MODEL_FIELD(Input, horizon),
+                    AGENT_MODEL_FIELD(Input, signals),
+                    AGENT_MODEL_FIELD(Input, lanes),
+                    AGENT_MODEL_FIELD(Input, targets),
+                    AGENT_MODEL_FIELD(Input, numSignals),
+                    AGENT_MODEL_FIELD(Input, numLanes),
+                    AGENT_MODEL_FIELD(Input, numTargets),
+                    AGENT_MODEL_FIELD(Input, numHorizon),
+                    AGENT_MODEL_FIELD(Input, countsValid)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(Input)
+
+        template<>
+        struct FieldTable<State> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(State, simulationTime),
+                    AGENT_MODEL_FIELD(State, decisions),
+                    AGENT_MODEL_FIELD(State, conscious),
+                    AGENT_MODEL_FIELD(State, subconscious),
+                    AGENT_MODEL_FIELD(State, aux)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(State)
+
+        template<>
+        struct FieldTable<Memory> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(Memory, vehicle),
+                    AGENT_MODEL_FIELD(Memory, velocity),
+                    AGENT_MODEL_FIELD(Memory, lateral),
+                    AGENT_MODEL_FIELD(Memory, laneChange)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(Memory)
+
+        template<>
+        struct FieldTable<Parameters> {
+            static constexpr Field fields[] = {
+                    AGENT_MODEL_FIELD(Parameters, vehicle),
+                    AGENT_MODEL_FIELD(Parameters, laneChange),
+                    AGENT_MODEL_FIELD(Parameters, stop),
+                    AGENT_MODEL_FIELD(Parameters, velocity),
+                    AGENT_MODEL_FIELD(Parameters, follow),
+                    AGENT_MODEL_FIELD(Parameters, steering)
+            };
+            static constexpr unsigned int count = sizeof(fields) / sizeof(Field);
+        };
+        AGENT_MODEL_CHECK_TABLE(Parameters)
+
+
+        /**
+         * Resolves a path (e.g. "targets[3].v") relative to the struct described by the given table
+         * A path ending on an array member without index addresses the whole array.
+         * @param fields Field table of the root struct
+         * @param count Number of entries in the field table
+         * @param path The path to be resolved
+         * @return The resolved field
+         */
+        Resolved resolve(const Field *fields, unsigned int count, const std::string &path);
+
+
+        /**
+         * Resolves a path relative to the struct T
+         * @param path The path to be resolved
+         * @return The resolved field
+         */
+        template<typename T>
+        Resolved resolve(const std::string &path) {
+            return resolve(FieldTable<T>::fields, FieldTable<T>::count, path);
+        }
+
+
+        /** Function to be called for every plain value (path, field, pointer to the value) */
+        using VisitFunction = std::function<void(const std::string &, const Field &, const void *)>;
+
+        /** Function to be called for every differing plain value (path, field, pointer to value a, pointer to value b) */
+        using DiffFunction = std::function<void(const std::string &, const Field &, const void *, const void *)>;
+
+
+        /**
+         * Converts a plain value to double (e.g. for recording)
+         * @param field The field of the value
+         * @param value Pointer to the value
+         * @return The value as double
+         */
+        double toDouble(const Field &field, const void *value);
+
+
+        /**
+         * Calls the function for every plain value of the struct in declaration order. Array elements are named with
+         * their index, e.g. "targets[3].xy.x".
+         * @param fields Field table of the struct
+         * @param count Number of entries in the field table
+         * @param data Pointer to the struct
+         * @param fnc Function to be called
+         */
+        void visit(const Field *fields, unsigned int count, const void *data, const VisitFunction &fnc);
+
+
+        /**
+         * Calls the function for every plain value of the struct T
+         * @param data The struct
+         * @param fnc Function to be called
+         */
+        template<typename T>
+        void visit(const T &data, const VisitFunction &fnc) {
+            visit(FieldTable<T>::fields, FieldTable<T>::count, &data, fnc);
+        }
+
+
+        /**
+         * Calls the function for every plain value, which differs between the two structs
+         * @param fields Field table of the struct
+         * @param count Number of entries in the field table
+         * @param a Pointer to the first struct
+         * @param b Pointer to the second struct
+         * @param fnc Function to be called
+         * @return Number of differing values
+         */
+        size_t diff(const Field *fields, unsigned int count, const void *a, const void *b, const DiffFunction &fnc);
+
+
+        /**
+         * Calls the function for every plain value, which differs between the two structs of type T
+         * @param a The first struct
+         * @param b The second struct
+         * @param fnc Function to be called
+         * @return Number of differing values
+         */
+        template<typename T>
+        size_t diff(const T &a, const T &b, const DiffFunction &fnc) {
+            return diff(FieldTable<T>::fields, FieldTable<T>::count, &a, &b, fnc);
+        }
+
+
+        /**
+         * Calculates a hash of the layout described by the field table (names, offsets, types, sizes and extents of
+         * all members, including nested structs). The hash changes with every change of the layout.
+         * @param fields Field table of the struct
+         * @param count Number of entries in the field table
+         * @param seed Seed of the hash (e.g. to combine hashes of several tables)
+         * @return The hash
+         */
+        uint64_t layoutHash(const Field *fields, unsigned int count, uint64_t seed = 14695981039346656037ULL);
+
+    } // namespace reflection
+
+} // namespace agent_model
+
+#endif // SIMDRIVER_REFLECTION_H
@@ -0,0 +1,218 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// RightOfWay.h
+
+#ifndef SIMDRIVER_RIGHT_OF_WAY_H
+#define SIMDRIVER_RIGHT_OF_WAY_H
+
+#include "Interface.h"
+
+namespace agent_model {
+
+
+    /*!< This enum describes the reaction of the driver to a target in the junction area. */
+    enum RightOfWay { ROW_PROCEED, ROW_YIELD, ROW_FIRST_COME };
+
+
+    /*!< The number of values of the enums used by the right-of-way rules. */
+    static const unsigned int NUMBER_OF_MANEUVERS = 3;
+    static const unsigned int NUMBER_OF_TARGET_POSITIONS = 6;
+    static const unsigned int NUMBER_OF_TARGET_PRIORITIES = 3;
+    static const unsigned int NUMBER_OF_TRAFFIC_LIGHT_ICONS = 5;
+
+
+    /**
+     * @brief The default right-of-way rules (right before left, priority and give way lanes, left turn arrows)
+     * A rule set is a class with two static constexpr functions, which are evaluated at compile time only
+     * (@see RightOfWayTable). The enum values are passed as integers, values out of the range of an enum are passed as
+     * the number of values of the enum.
+     */
+    struct RightBeforeLeft {
+
+        /**
+         * Returns the reaction to a target in the junction area
+         * @param priority Flag whether the ego lane has priority
+         * @param giveWay Flag whether the ego lane has to give way
+         * @param maneuver The maneuver of the ego vehicle
+         * @param position The position of the target in the junction
+         * @param targetPriority The priority of the lane of the target
+         * @return The reaction
+         */
+        static constexpr RightOfWay target(bool priority, bool giveWay, int maneuver, int position, int targetPriority) {
+
+            // ego is on priority: only a left turn yields (to opposite targets)
+            if (priority && maneuver == TURN_LEFT)
+                return position == TARGET_ON_OPPOSITE ? ROW_YIELD : ROW_PROCEED;
+
+            // ego is on give way lane
+            if (giveWay) {
+
+                // stop for target already on intersection and if target priority not set (passive behavior)
+                if (position == TARGET_ON_INTERSECTION || targetPriority == TARGET_PRIORITY_NOT_SET)
+                    return ROW_YIELD;
+
+                // if target has to give way as well (special cases, otherwise first come, first drive)
+                if (targetPriority == TARGET_ON_GIVE_WAY_LANE) {
+
+                    if (position == TARGET_ON_OPPOSITE)
+                        return maneuver == TURN_LEFT ? ROW_YIELD : ROW_PROCEED;
+
+                    if (position == TARGET_ON_RIGHT && maneuver == TURN_RIGHT)
+                        return ROW_PROCEED;
+
+                    return ROW_FIRST_COME;
+
+                }
+
+                // stop for target on priority lane
+                if (targetPriority == TARGET_ON_PRIORITY_LANE)
+                    return ROW_YIELD;
+
+            }
+
+            // ego is not on priority and give way lane (right before left)
+            if (!priority && !giveWay) {
+
+                if (position == TARGET_ON_INTERSECTION || position == TARGET_ON_RIGHT)
+                    return ROW_YIELD;
+
+                if (position == TARGET_ON_OPPOSITE && maneuver == TURN_LEFT)
+                    return ROW_YIELD;
+
+            }
+
+            return ROW_PROCEED;
+
+        }
+
+
+        /**
+         * Returns whether the driver passes a green traffic light
+         * @param icon The icon of the traffic light
+         * @param maneuver The maneuver of the ego vehicle
+         * @return Flag whether to drive
+         */
+        static constexpr bool green(int icon, int maneuver) {
+
+            // drive if green and straight or if green-left-arrow and left turn
+            return maneuver == STRAIGHT || (icon == ICON_ARROW_LEFT && maneuver == TURN_LEFT);
+
+        }
+
+    };
+
+
+    /**
+     * @brief A decision table of right-of-way rules, which is built at compile time
+     * The table holds the reactions of the rule set for all combinations of the inputs, so the decision is a lookup
+     * without any branches on the enums. Rule sets are swapped by the template parameter (@see decisionProcessStop()).
+     */
+    template<typename Rules>
+    class RightOfWayTable {
+
+        RightOfWay _target[2][2][NUMBER_OF_MANEUVERS + 1][NUMBER_OF_TARGET_POSITIONS + 1][NUMBER_OF_TARGET_PRIORITIES + 1];
+        bool _green[NUMBER_OF_TRAFFIC_LIGHT_ICONS + 1][NUMBER_OF_MANEUVERS + 1];
+
+
+        /**
+         * Returns the index of an enum value, values out of range share the last index
+         * @param value The value
+         * @param n The number of values of the enum
+         * @return The index
+         */
+        static constexpr unsigned int index(int value, unsigned int n) {
+            return value >= 0 && (unsigned int) value < n ? (unsigned int) value : n;
+        }
+
+
+    public:
+
+        /**
+         * Constructor. Evaluates the rule set for all combinations.
+         */
+        constexpr RightOfWayTable() : _target{}, _green{} {
+
+            for (unsigned int p = 0; p < 2; ++p) {
+                for (unsigned int g = 0; g < 2; ++g) {
+                    for (unsigned int m = 0; m <= NUMBER_OF_MANEUVERS; ++m) {
+                        for (unsigned int i = 0; i <= NUMBER_OF_TARGET_POSITIONS; ++i) {
+                            for (unsigned int q = 0; q <= NUMBER_OF_TARGET_PRIORITIES; ++q)
+                                _target[p][g][m][i][q] = Rules::target(p != 0, g != 0, (int) m, (int) i, (int) q);
+                        }
+                    }
+                }
+            }
+
+            for (unsigned int i = 0; i <= NUMBER_OF_TRAFFIC_LIGHT_ICONS; ++i) {
+                for (unsigned int m = 0; m <= NUMBER_OF_MANEUVERS; ++m)
+                    _green[i][m] = Rules::green((int) i, (int) m);
+            }
+
+        }
+
+
+        /**
+         * Returns the reaction to a target in the junction area
+         * @param priority Flag whether the ego lane has priority
+         * @param giveWay Flag whether the ego lane has to give way
+         * @param maneuver The maneuver of the ego vehicle
+         * @param target The target
+         * @return The reaction
+         */
+        template<typename T>
+        constexpr RightOfWay target(bool priority, bool giveWay, Maneuver maneuver, const BasicTarget<T> &target) const {
+            return _target[priority][giveWay][index(maneuver, NUMBER_OF_MANEUVERS)]
+                    [index(target.position, NUMBER_OF_TARGET_POSITIONS)]
+                    [index(target.priority, NUMBER_OF_TARGET_PRIORITIES)];
+        }
+
+
+        /**
+         * Returns whether the driver passes a green traffic light
+         * @param icon The icon of the traffic light
+         * @param maneuver The maneuver of the ego vehicle
+         * @return Flag whether to drive
+         */
+        constexpr bool green(TrafficLightIcon icon, Maneuver maneuver) const {
+            return _green[index(icon, NUMBER_OF_TRAFFIC_LIGHT_ICONS)][index(maneuver, NUMBER_OF_MANEUVERS)];
+        }
+
+    };
+
+
+    /**
+     * @brief The decision table of a rule set (one instance per rule set)
+     */
+    template<typename Rules>
+    struct RightOfWayRules {
+        static constexpr RightOfWayTable<Rules> table{}; //!< The decision table
+    };
+
+    template<typename Rules>
+    constexpr RightOfWayTable<Rules> RightOfWayRules<Rules>::table;
+
+
+} // namespace agent_model
+
+#endif // SIMDRIVER_RIGHT_OF_WAY_H
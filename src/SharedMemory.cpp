@@ -0,0 +1,449 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// SharedMemory.cpp
+
+
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "SharedMemory.h"
+
+namespace agent_model {
+
+
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex words must be plain 32 bit integers.");
+
+    static const int SPIN = 4096;     //!< Number of polls before sleeping
+    static const size_t LINE = 64;    //!< Alignment of the slots
+
+
+    /**
+     * Rounds the size up to a multiple of the slot alignment
+     */
+    static size_t align(size_t size) {
+        return (size + LINE - 1) / LINE * LINE;
+    }
+
+
+    /**
+     * Throws a runtime error with the description of errno
+     */
+    static void fail(const std::string &message) {
+        throw std::runtime_error(message + " (" + std::strerror(errno) + ").");
+    }
+
+
+    /**
+     * Calls the futex system call on the word (shared between processes, therefore not private)
+     */
+    static void futex(std::atomic<uint32_t> &word, int op, uint32_t value) {
+        syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), op, value, nullptr, nullptr, 0);
+    }
+
+
+    /**
+     * Waits until the word differs from the given value and returns the new value
+     */
+    static uint32_t wait(std::atomic<uint32_t> &word, std::atomic<uint32_t> &waiting, uint32_t value) {
+
+        // spin
+        for (int i = 0; i < SPIN; ++i) {
+            auto w = word.load(std::memory_order_acquire);
+            if (w != value)
+                return w;
+        }
+
+        // sleep (the flag is set before the word is checked again, the writer checks the flag after the update)
+        while (true) {
+
+            waiting.store(1, std::memory_order_seq_cst);
+
+            auto w = word.load(std::memory_order_seq_cst);
+            if (w != value) {
+                waiting.store(0, std::memory_order_relaxed);
+                return w;
+            }
+
+            futex(word, FUTEX_WAIT, value);
+
+        }
+
+    }
+
+
+    /**
+     * Updates the word and wakes the other side, if sleeping
+     */
+    static void publish(std::atomic<uint32_t> &word, std::atomic<uint32_t> &waiting, uint32_t value) {
+
+        word.store(value, std::memory_order_seq_cst);
+
+        if (waiting.load(std::memory_order_seq_cst) != 0)
+            futex(word, FUTEX_WAKE, INT_MAX);
+
+    }
+
+
+    SharedMemory::~SharedMemory() {
+
+        close();
+
+    }
+
+
+    void SharedMemory::create(const std::string &name, unsigned int agents, unsigned int slots) {
+
+        if (agents == 0)
+            throw std::invalid_argument("number of agents must be greater than zero.");
+
+        // the positions wrap around at 2^32, the slot index must stay continuous
+        if (slots == 0 || (slots & (slots - 1)) != 0)
+            throw std::invalid_argument("number of slots must be a power of two.");
+
+        close();
+
+        // calculate layout
+        Header header{};
+        header.magic = 0;
+        header.version = VERSION;
+        header.agents = agents;
+        header.slots = slots;
+        header.inputSize = sizeof(Input);
+        header.resultSize = sizeof(Subconscious);
+        header.requestSize = align(sizeof(Request) + agents * sizeof(Input));
+        header.responseSize = align(sizeof(Response) + agents * sizeof(Subconscious));
+
+        auto size = align(sizeof(Header)) + 2 * align(sizeof(Ring))
+                    + slots * (header.requestSize + header.responseSize);
+
+        // create region
+        auto fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0600);
+        if (fd < 0)
+            fail("cannot create shared memory \"" + name + "\"");
+
+        // reset content
+        if (ftruncate(fd, 0) != 0 || ftruncate(fd, (off_t) size) != 0) {
+            ::close(fd);
+            shm_unlink(name.c_str());
+            fail("cannot resize shared memory \"" + name + "\"");
+        }
+
+        _base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+
+        if (_base == MAP_FAILED) {
+            _base = nullptr;
+            shm_unlink(name.c_str());
+            fail("cannot map shared memory \"" + name + "\"");
+        }
+
+        _name = name;
+        _size = size;
+        _creator = true;
+
+        // initialize (the region is zero-filled, the magic number is set last)
+        _header = static_cast<Header *>(_base);
+        std::memcpy(_header, &header, sizeof(Header));
+        map();
+
+        std::atomic_thread_fence(std::memory_order_release);
+        reinterpret_cast<std::atomic<uint32_t> *>(&_header->magic)->store(MAGIC, std::memory_order_release);
+
+    }
+
+
+    void SharedMemory::open(const std::string &name) {
+
+        close();
+
+        auto fd = shm_open(name.c_str(), O_RDWR, 0600);
+        if (fd < 0)
+            fail("cannot open shared memory \"" + name + "\"");
+
+        struct stat st{};
+        if (fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(Header)) {
+            ::close(fd);
+            throw std::invalid_argument("shared memory \"" + name + "\" is not a valid region.");
+        }
+
+        _base = mmap(nullptr, (size_t) st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+
+        if (_base == MAP_FAILED) {
+            _base = nullptr;
+            fail("cannot map shared memory \"" + name + "\"");
+        }
+
+        _name = name;
+        _size = (size_t) st.st_size;
+        _creator = false;
+        _header = static_cast<Header *>(_base);
+
+        // check layout
+        auto &h = *_header;
+        auto magic = reinterpret_cast<std::atomic<uint32_t> *>(&h.magic)->load(std::memory_order_acquire);
+        auto fixed = align(sizeof(Header)) + 2 * align(sizeof(Ring));
+        if (magic != MAGIC || h.version != VERSION || h.inputSize != sizeof(Input)
+            || h.resultSize != sizeof(Subconscious) || h.agents == 0
+            || h.slots == 0 || (h.slots & (h.slots - 1)) != 0
+            || h.requestSize != align(sizeof(Request) + (size_t) h.agents * sizeof(Input))
+            || h.responseSize != align(sizeof(Response) + (size_t) h.agents * sizeof(Subconscious))
+            || fixed > _size || h.slots > (_size - fixed) / (h.requestSize + h.responseSize)) {
+            close();
+            throw std::invalid_argument("shared memory \"" + name + "\" has an incompatible layout.");
+        }
+
+        map();
+
+    }
+
+
+    void SharedMemory::close() {
+
+        if (_base != nullptr)
+            munmap(_base, _size);
+
+        if (_creator)
+            shm_unlink(_name.c_str());
+
+        _base = nullptr;
+        _size = 0;
+        _creator = false;
+        _header = nullptr;
+        _requests = nullptr;
+        _responses = nullptr;
+        _requestSlots = nullptr;
+        _responseSlots = nullptr;
+
+    }
+
+
+    unsigned int SharedMemory::agents() const {
+
+        return _header == nullptr ? 0 : _header->agents;
+
+    }
+
+
+    Input *SharedMemory::beginRequest() {
+
+        // wait for a free slot
+        auto head = _requests->head.load(std::memory_order_relaxed);
+        auto tail = _requests->tail.load(std::memory_order_acquire);
+        while (head - tail >= _header->slots)
+            tail = wait(_requests->tail, _requests->tailWaiting, tail);
+
+        return reinterpret_cast<Input *>(request(head) + 1);
+
+    }
+
+
+    void SharedMemory::commitRequest(double time, unsigned int count, bool stop) {
+
+        if (count > _header->agents)
+            throw std::invalid_argument("number of agents exceeds the size of the region.");
+
+        auto head = _requests->head.load(std::memory_order_relaxed);
+
+        auto r = request(head);
+        r->step = head;
+        r->time = time;
+        r->count = count;
+        r->stop = stop ? 1 : 0;
+
+        publish(_requests->head, _requests->headWaiting, head + 1);
+
+    }
+
+
+    const Subconscious *SharedMemory::waitResponse(unsigned int &count) {
+
+        auto tail = _responses->tail.load(std::memory_order_relaxed);
+        auto head = _responses->head.load(std::memory_order_acquire);
+        while (head == tail)
+            head = wait(_responses->head, _responses->headWaiting, head);
+
+        auto r = response(tail);
+        count = r->count;
+
+        // failed request
+        if (r->status != STATUS_OK) {
+            releaseResponse();
+            throw std::runtime_error("driver process failed to serve the request.");
+        }
+
+        return reinterpret_cast<const Subconscious *>(r + 1);
+
+    }
+
+
+    void SharedMemory::releaseResponse() {
+
+        auto tail = _responses->tail.load(std::memory_order_relaxed);
+        publish(_responses->tail, _responses->tailWaiting, tail + 1);
+
+    }
+
+
+    Input *SharedMemory::waitRequest(double &time, unsigned int &count) {
+
+        auto tail = _requests->tail.load(std::memory_order_relaxed);
+        auto head = _requests->head.load(std::memory_order_acquire);
+        while (head == tail)
+            head = wait(_requests->head, _requests->headWaiting, head);
+
+        auto r = request(tail);
+        time = r->time;
+        count = r->count;
+
+        return r->stop != 0 ? nullptr : reinterpret_cast<Input *>(r + 1);
+
+    }
+
+
+    void SharedMemory::releaseRequest() {
+
+        auto tail = _requests->tail.load(std::memory_order_relaxed);
+        publish(_requests->tail, _requests->tailWaiting, tail + 1);
+
+    }
+
+
+    Subconscious *SharedMemory::beginResponse() {
+
+        auto head = _responses->head.load(std::memory_order_relaxed);
+        auto tail = _responses->tail.load(std::memory_order_acquire);
+        while (head - tail >= _header->slots)
+            tail = wait(_responses->tail, _responses->tailWaiting, tail);
+
+        return reinterpret_cast<Subconscious *>(response(head) + 1);
+
+    }
+
+
+    void SharedMemory::commitResponse(unsigned int count, uint32_t status) {
+
+        auto head = _responses->head.load(std::memory_order_relaxed);
+
+        auto r = response(head);
+        r->step = request(_requests->tail.load(std::memory_order_relaxed))->step;
+        r->count = count;
+        r->status = status;
+
+        publish(_responses->head, _responses->headWaiting, head + 1);
+
+    }
+
+
+    void SharedMemory::serve(AgentModel *agents, unsigned int n) {
+
+        double time;
+        unsigned int count;
+
+        while (true) {
+
+            auto inputs = waitRequest(time, count);
+
+            // stop request
+            if (inputs == nullptr) {
+                releaseRequest();
+                return;
+            }
+
+            // step agents
+            auto results = beginResponse();
+            unsigned int k = 0;
+
+            try {
+
+                if (count > n)
+                    throw std::invalid_argument("number of agents in the request exceeds the number of agents.");
+
+                for (; k < count; ++k) {
+
+                    // step in place
+                    agents[k].bind(&inputs[k], nullptr);
+                    agents[k].step(time);
+                    agents[k].bind(nullptr, nullptr);
+
+                    results[k] = agents[k].getState()->subconscious;
+
+                }
+
+            } catch (...) {
+
+                // release the slots, so the simulator does not wait forever
+                if (k < count && k < n)
+                    agents[k].bind(nullptr, nullptr);
+
+                commitResponse(0, STATUS_FAILED);
+                releaseRequest();
+                throw;
+
+            }
+
+            commitResponse(count);
+            releaseRequest();
+
+        }
+
+    }
+
+
+    void SharedMemory::map() {
+
+        auto base = static_cast<char *>(_base);
+
+        _requests = reinterpret_cast<Ring *>(base + align(sizeof(Header)));
+        _responses = reinterpret_cast<Ring *>(base + align(sizeof(Header)) + align(sizeof(Ring)));
+        _requestSlots = base + align(sizeof(Header)) + 2 * align(sizeof(Ring));
+        _responseSlots = _requestSlots + _header->slots * _header->requestSize;
+
+    }
+
+
+    SharedMemory::Request *SharedMemory::request(uint32_t i) const {
+
+        return reinterpret_cast<Request *>(_requestSlots + (i % _header->slots) * _header->requestSize);
+
+    }
+
+
+    SharedMemory::Response *SharedMemory::response(uint32_t i) const {
+
+        return reinterpret_cast<Response *>(_responseSlots + (i % _header->slots) * _header->responseSize);
+
+    }
+
+
+}
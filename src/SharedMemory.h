@@ -0,0 +1,263 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// SharedMemory.h
+
+
+#ifndef SIMDRIVER_SHARED_MEMORY_H
+#define SIMDRIVER_SHARED_MEMORY_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include "AgentModel.h"
+
+namespace agent_model {
+
+
+    /**
+     * @brief A shared-memory transport to step agents in a separate process (Linux only)
+     * The simulator creates a named region, writes the inputs of N agents into a request slot and receives the
+     * subconscious states of the agents in a response slot. The driver process opens the region and serves the
+     * requests. Requests and responses are passed through two single-producer/single-consumer ring buffers with a
+     * fixed number of slots. The reader spins shortly and then sleeps on a futex, which the writer only wakes if the
+     * reader is actually sleeping. The slots are written and read in place.
+     */
+    class SharedMemory {
+
+    public:
+
+        static const uint32_t MAGIC = 0x4d485344;    //!< The magic number of the region ("DSHM")
+        static const uint32_t VERSION = 3;           //!< The version of the region layout
+
+        static const uint32_t STATUS_OK = 0;         //!< Response status: the agents were stepped
+        static const uint32_t STATUS_FAILED = 1;     //!< Response status: the driver process failed to serve the request
+
+
+        /**
+         * @brief The header of the region
+         */
+        struct Header {
+            uint32_t magic;            //!< The magic number
+            uint32_t version;          //!< The version of the layout
+            uint32_t agents;           //!< The maximum number of agents per request
+            uint32_t slots;            //!< The number of slots per ring
+            uint64_t inputSize;        //!< The size of the input struct
+            uint64_t resultSize;       //!< The size of the result struct
+            uint64_t requestSize;      //!< The size of a request slot
+            uint64_t responseSize;     //!< The size of a response slot
+        };
+
+
+        /**
+         * @brief The positions of a ring buffer, written by producer and consumer respectively
+         */
+        struct Ring {
+            alignas(64) std::atomic<uint32_t> head;           //!< The number of published slots (producer)
+            std::atomic<uint32_t> headWaiting;                //!< Flag whether the consumer sleeps on head
+            alignas(64) std::atomic<uint32_t> tail;           //!< The number of released slots (consumer)
+            std::atomic<uint32_t> tailWaiting;                //!< Flag whether the producer sleeps on tail
+        };
+
+
+        /**
+         * @brief The header of a request slot, followed by the inputs
+         */
+        struct Request {
+            uint64_t step;             //!< The step counter
+            double time;               //!< The simulation time
+            uint32_t count;            //!< The number of agents to be stepped
+            uint32_t stop;             //!< Flag to stop the driver process
+        };
+
+
+        /**
+         * @brief The header of a response slot, followed by the results
+         */
+        struct Response {
+            uint64_t step;             //!< The step counter of the request
+            uint32_t count;            //!< The number of results
+            uint32_t status;           //!< The status of the response (@see STATUS_OK, STATUS_FAILED)
+        };
+
+
+        /**
+         * Default constructor
+         */
+        SharedMemory() = default;
+
+
+        SharedMemory(const SharedMemory &) = delete;
+        SharedMemory &operator=(const SharedMemory &) = delete;
+
+
+        /**
+         * Destructor, unmaps the region (and removes it, if created by this instance)
+         */
+        ~SharedMemory();
+
+
+        /**
+         * Creates the region (simulator side)
+         * @param name Name of the region (e.g. "/simdriver")
+         * @param agents Maximum number of agents per request
+         * @param slots Number of slots per ring (power of two)
+         */
+        void create(const std::string &name, unsigned int agents, unsigned int slots = 4);
+
+
+        /**
+         * Opens an existing region (driver side). The region is rejected if its header does not match the layout of
+         * this build (struct sizes, slot sizes for the number of agents and the size of the mapped region).
+         * @param name Name of the region
+         */
+        void open(const std::string &name);
+
+
+        /**
+         * Unmaps the region and removes it, if created by this instance
+         */
+        void close();
+
+
+        /**
+         * Returns the maximum number of agents per request
+         * @return Number of agents
+         */
+        unsigned int agents() const;
+
+
+        /**
+         * Waits for a free request slot and returns the inputs to be written (simulator side)
+         * @return The inputs of the request slot
+         */
+        Input *beginRequest();
+
+
+        /**
+         * Publishes the request slot (simulator side)
+         * @param time The simulation time
+         * @param count The number of agents to be stepped
+         * @param stop Flag to stop the driver process
+         */
+        void commitRequest(double time, unsigned int count, bool stop = false);
+
+
+        /**
+         * Waits for the next response (simulator side)
+         * If the driver process failed to serve the request, the response is released and a std::runtime_error is
+         * thrown.
+         * @param count Number of results
+         * @return The results, valid until releaseResponse is called
+         */
+        const Subconscious *waitResponse(unsigned int &count);
+
+
+        /**
+         * Releases the response slot (simulator side)
+         */
+        void releaseResponse();
+
+
+        /**
+         * Waits for the next request (driver side)
+         * @param time The simulation time
+         * @param count The number of agents to be stepped
+         * @return The inputs, valid until releaseRequest is called, or nullptr if the driver process shall stop
+         */
+        Input *waitRequest(double &time, unsigned int &count);
+
+
+        /**
+         * Releases the request slot (driver side)
+         */
+        void releaseRequest();
+
+
+        /**
+         * Waits for a free response slot and returns the results to be written (driver side)
+         * @return The results of the response slot
+         */
+        Subconscious *beginResponse();
+
+
+        /**
+         * Publishes the response slot (driver side)
+         * @param count The number of results
+         * @param status The status of the response
+         */
+        void commitResponse(unsigned int count, uint32_t status = STATUS_OK);
+
+
+        /**
+         * Serves the requests with the given agents until a stop request is received (driver side). The agents are
+         * bound to the inputs in the request slot during the step, so the inputs are not copied. If a request cannot
+         * be served (e.g. too many agents), a failed response is published and the request is released before the
+         * exception is thrown, so the simulator does not wait forever.
+         * @param agents The agents
+         * @param n The number of agents
+         */
+        void serve(AgentModel *agents, unsigned int n);
+
+
+    protected:
+
+        std::string _name{};               //!< The name of the region
+        void *_base = nullptr;             //!< The mapped region
+        size_t _size = 0;                  //!< The size of the mapped region
+        bool _creator = false;             //!< Flag whether the region was created by this instance
+
+        Header *_header = nullptr;         //!< The header of the region
+        Ring *_requests = nullptr;         //!< The request ring
+        Ring *_responses = nullptr;        //!< The response ring
+        char *_requestSlots = nullptr;     //!< The request slots
+        char *_responseSlots = nullptr;    //!< The response slots
+
+
+        /**
+         * Sets the pointers into the mapped region
+         */
+        void map();
+
+
+        /**
+         * Returns the request slot at the given position
+         * @param i Position
+         * @return The request slot
+         */
+        Request *request(uint32_t i) const;
+
+
+        /**
+         * Returns the response slot at the given position
+         * @param i Position
+         * @return The response slot
+         */
+        Response *response(uint32_t i) const;
+
+    };
+
+
+}
+
+#endif // SIMDRIVER_SHARED_MEMORY_H
@@ -0,0 +1,100 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// Snapshot.h
+
+
+#ifndef SIMDRIVER_SNAPSHOT_H
+#define SIMDRIVER_SNAPSHOT_H
+
+#include <cstring>
+#include <cstdint>
+#include <stdexcept>
+
+namespace agent_model {
+
+    /**
+     * @brief Helper functions to write and read plain values to and from a flat snapshot buffer
+     * The buffer does not contain any pointers, so it can be copied, stored or moved freely.
+     */
+    namespace snapshot {
+
+        static const uint32_t MAGIC = 0x4e534453; //!< Magic number of a snapshot buffer ("SDSN")
+        static const uint32_t VERSION = 4;        //!< Version of the snapshot layout
+
+
+        /** @brief The header of a snapshot buffer */
+        struct Header {
+            uint32_t magic;   //!< The magic number (@see MAGIC)
+            uint32_t version; //!< The version of the layout (@see VERSION)
+            uint64_t size;    //!< The total size of the snapshot including the header (in *bytes*)
+        };
+
+
+        /**
+         * Writes the value to the buffer
+         * @param buffer Buffer to be written to
+         * @param value Value to be written
+         * @return Pointer behind the written value
+         */
+        template<typename T>
+        char *write(char *buffer, const T &value) {
+
+            std::memcpy(buffer, &value, sizeof(T));
+            return buffer + sizeof(T);
+
+        }
+
+
+        /**
+         * Reads the value from the buffer
+         * @param buffer Buffer to be read from
+         * @param value Value to be read
+         * @return Pointer behind the read value
+         */
+        template<typename T>
+        const char *read(const char *buffer, T &value) {
+
+            std::memcpy(&value, buffer, sizeof(T));
+            return buffer + sizeof(T);
+
+        }
+
+
+        /**
+         * Checks that a section fits into the remaining buffer
+         * @param size Size of the section (in *bytes*)
+         * @param available Remaining size of the buffer (in *bytes*)
+         */
+        inline void require(size_t size, size_t available) {
+
+            if (size > available)
+                throw std::invalid_argument("snapshot buffer is too small.");
+
+        }
+
+    }
+
+}
+
+#endif // SIMDRIVER_SNAPSHOT_H
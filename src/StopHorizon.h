@@ -26,9 +26,10 @@
 #ifndef SIMDRIVER_STOPHORIZON_H
 #define SIMDRIVER_STOPHORIZON_H
 
-#include <map>
 #include <cmath>
 #include <limits>
+#include <stdexcept>
+#include "Snapshot.h"
 
 #ifndef EPS_TIME
 #define EPS_TIME 1e-6
@@ -41,22 +42,35 @@
 namespace agent_model {
 
 
-    class StopHorizon {
+    /**
+     * @brief A class to store the stop points
+     * The stop points are stored in a fixed-size array sorted by their ID, so the horizon can be copied without
+     * allocating memory.
+     * @tparam T The scalar type of the positions and times
+     */
+    template<typename T>
+    class BasicStopHorizon {
+
+    public:
+
+        static const unsigned int MAX_ELEMENTS = 32; //!< Maximum number of stop points stored at the same time
 
     protected:
 
         constexpr static const double DELETE_AFTER_DISTANCE = 10.0; //!< Distance after which the stop point is deleted from the list
 
         struct _StopPoint {
-            double s = INFINITY;
-            double sStart = INFINITY;
-            double timeStartStanding = INFINITY;
-            double standingTime = INFINITY;
+            unsigned long id = 0;
+            T s = INFINITY;
+            T sStart = INFINITY;
+            T timeStartStanding = INFINITY;
+            T standingTime = INFINITY;
             bool passed = false;
         };
 
-        double _sActual = 0.0;
-        std::map<unsigned long, _StopPoint> _elements{};
+        T _sActual = 0.0;
+        unsigned int _size = 0;
+        _StopPoint _elements[MAX_ELEMENTS]{};
 
 
     public:
@@ -64,8 +78,8 @@ namespace agent_model {
         /** @brief a struct to store a stop point */
         struct StopPoint {
             unsigned long id;
-            double ds;
-            double interval;
+            T ds;
+            T interval;
         };
 
 
@@ -73,38 +87,74 @@ namespace agent_model {
          * Inits the stop horizon
          * @param s Initial distance
          */
-        void init(double s) {
+        void init(T s) {
 
             _sActual = s;
-            if (_elements.size() > 0) _elements.clear();
+            _size = 0;
 
         }
 
 
         /**
          * Adds a stop point to the list if it doesn't exist already
+         * At most MAX_ELEMENTS stop points are stored. If the list is full, a passed stop point or else the farthest
+         * stop point is dropped for a nearer one; a dropped stop point is added again when it is reported later on.
          * @param id ID of the stop
          * @param sStop Absolute position of the stop
          * @param standingTime The time the vehicle shall stand at the given stop (inf: until reset)
          * @return Flag to indicate if the stop point was added
          */
-        bool addStopPoint(unsigned long id, double sStop, double standingTime) {
+        bool addStopPoint(unsigned long id, T sStop, T standingTime) {
+
+            using namespace std;
+
+            auto e = find(id);
 
-            if(_elements.find(id) != _elements.end() && standingTime == 0) {
-                _elements[id].passed = true;
+            if(e != nullptr && standingTime == 0) {
+                e->passed = true;
                 return true;
             }
             // only add if not already added
-            if(_elements.find(id) != _elements.end())
-                if (fabs(_elements[id].s - sStop) < 0.5)
+            if(e != nullptr)
+                if (abs(e->s - sStop) < 0.5)
                     return false;
 
             // only add when distance is large enough
             if(_sActual - sStop >= DELETE_AFTER_DISTANCE - EPS_DISTANCE)
                 return false;
 
+            // insert sorted by ID, if not already in the list
+            if(e == nullptr) {
+
+                // list is full: drop a passed or the farthest stop point, so the nearest stops are always kept
+                if(_size == MAX_ELEMENTS) {
+
+                    unsigned int r = 0;
+                    for(unsigned int j = 1; j < _size && !_elements[r].passed; ++j) {
+                        if(_elements[j].passed || _elements[j].s > _elements[r].s)
+                            r = j;
+                    }
+
+                    // the new stop point is the farthest one (added again when the list has space)
+                    if(!_elements[r].passed && _elements[r].s <= sStop)
+                        return false;
+
+                    for(--_size; r < _size; ++r)
+                        _elements[r] = _elements[r + 1];
+
+                }
+
+                // shift elements with a larger ID
+                unsigned int j = _size++;
+                for(; j > 0 && _elements[j - 1].id > id; --j)
+                    _elements[j] = _elements[j - 1];
+
+                e = &_elements[j];
+
+            }
+
             // add to list
-            _elements[id] = {sStop, _sActual, INFINITY, standingTime, false};
+            *e = {id, sStop, _sActual, INFINITY, standingTime, false};
 
             return true;
             
@@ -118,13 +168,19 @@ namespace agent_model {
          * @param actualTime The actual simulation time
          * @return Returns a flag whether the time was set or not
          */
-        bool stopped(unsigned long id, double actualTime) {
+        bool stopped(unsigned long id, T actualTime) {
+
+            using namespace std;
+
+            auto e = find(id);
+            if(e == nullptr)
+                throw std::out_of_range("stop point does not exist.");
 
             // only set start time if not set before
-            if(std::isinf(_elements.at(id).timeStartStanding)) {
+            if(isinf(e->timeStartStanding)) {
 
                 // set start time to actual time
-                _elements.at(id).timeStartStanding = actualTime;
+                e->timeStartStanding = actualTime;
 
                 // return success
                 return true;
@@ -142,15 +198,15 @@ namespace agent_model {
          * @param actualPosition Actual position
          * @param actualTime Actual simulation time
          */
-        void update(double actualPosition, double actualTime) {
+        void update(T actualPosition, T actualTime) {
 
             _sActual = actualPosition;
 
             // iterate over elements
-            for(auto &ke : _elements) {
+            for(unsigned int j = 0; j < _size; ++j) {
 
                 // get element
-                auto &e = ke.second;
+                auto &e = _elements[j];
 
                 // ignore passed stops
                 if(e.passed)
@@ -163,17 +219,22 @@ namespace agent_model {
             }
 
             // clean up
-            auto it = _elements.cbegin();
-            while(it != _elements.cend()) {
+            unsigned int k = 0;
+            for(unsigned int j = 0; j < _size; ++j) {
 
                 // delete elements after passed and distance large
-                if(it->second.passed && _sActual - it->second.s >= DELETE_AFTER_DISTANCE - EPS_DISTANCE)
-                    it = _elements.erase(it);
-                else
-                    it++;
+                if(_elements[j].passed && _sActual - _elements[j].s >= DELETE_AFTER_DISTANCE - EPS_DISTANCE)
+                    continue;
+
+                // keep element
+                if(k != j)
+                    _elements[k] = _elements[j];
+
+                k++;
 
             }
 
+            _size = k;
 
         }
 
@@ -182,21 +243,21 @@ namespace agent_model {
          * Returns the next stop point
          * @return
          */
-        StopPoint getNextStop() {
+        StopPoint getNextStop() const {
 
             // init
-            double dsMin = INFINITY;
-            double interval = INFINITY;
+            T dsMin = INFINITY;
+            T interval = INFINITY;
             unsigned long id = (std::numeric_limits<unsigned long>::max)();
 
             // iterate over elements
-            for(auto &ke : _elements) {
+            for(unsigned int j = 0; j < _size; ++j) {
 
                 // get element
-                auto &e = ke.second;
+                auto &e = _elements[j];
 
                 // save distance
-                double ds = e.s - _sActual;
+                T ds = e.s - _sActual;
 
                 // ignore
                 if(e.passed || ds > dsMin)
@@ -204,7 +265,7 @@ namespace agent_model {
 
                 // save data
                 dsMin = ds;
-                id = ke.first;
+                id = e.id;
                 interval = e.s - e.sStart;
 
             }
@@ -215,8 +276,102 @@ namespace agent_model {
         }
 
 
+        /**
+         * Returns the number of bytes needed to store the stop horizon in a snapshot
+         * @return Number of bytes
+         */
+        size_t snapshotSize() const {
+
+            return sizeof(_sActual) + sizeof(_size) + _size * sizeof(_StopPoint);
+
+        }
+
+
+        /**
+         * Checks the stop horizon section of a snapshot buffer without restoring it
+         * @param buffer Buffer to be checked
+         * @param available Remaining size of the buffer (in *bytes*)
+         * @return Size of the section (in *bytes*)
+         */
+        static size_t checkSnapshot(const char *buffer, size_t available) {
+
+            unsigned int size = 0;
+            snapshot::require(sizeof(_sActual) + sizeof(_size), available);
+            snapshot::read(buffer + sizeof(_sActual), size);
+
+            // check size
+            if(size > MAX_ELEMENTS)
+                throw std::invalid_argument("snapshot buffer is invalid.");
+
+            auto total = sizeof(_sActual) + sizeof(_size) + size * sizeof(_StopPoint);
+            snapshot::require(total, available);
+            return total;
+
+        }
+
+
+        /**
+         * Writes the stop horizon to the snapshot buffer
+         * @param buffer Buffer to be written to
+         * @return Pointer behind the written data
+         */
+        char *save(char *buffer) const {
+
+            buffer = snapshot::write(buffer, _sActual);
+            buffer = snapshot::write(buffer, _size);
+
+            // write elements
+            std::memcpy(buffer, _elements, _size * sizeof(_StopPoint));
+            return buffer + _size * sizeof(_StopPoint);
+
+        }
+
+
+        /**
+         * Restores the stop horizon from the snapshot buffer
+         * @param buffer Buffer to be read from
+         * @return Pointer behind the read data
+         */
+        const char *restore(const char *buffer) {
+
+            buffer = snapshot::read(buffer, _sActual);
+            buffer = snapshot::read(buffer, _size);
+
+            // check size
+            if(_size > MAX_ELEMENTS)
+                throw std::invalid_argument("snapshot buffer is invalid.");
+
+            // read elements
+            std::memcpy(_elements, buffer, _size * sizeof(_StopPoint));
+            return buffer + _size * sizeof(_StopPoint);
+
+        }
+
+
+    protected:
+
+
+        /**
+         * Returns the stop point with the given ID
+         * @param id ID of the stop
+         * @return Pointer to the stop point, nullptr if not existing
+         */
+        _StopPoint *find(unsigned long id) {
+
+            for(unsigned int j = 0; j < _size; ++j) {
+                if(_elements[j].id == id)
+                    return &_elements[j];
+            }
+
+            return nullptr;
+
+        }
+
+
     };
 
+    typedef BasicStopHorizon<double> StopHorizon; //!< The stop horizon with double values
+
 
 }
 
@@ -0,0 +1,265 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// TargetSummary.h
+
+#ifndef SIMDRIVER_TARGET_SUMMARY_H
+#define SIMDRIVER_TARGET_SUMMARY_H
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "Interface.h"
+
+namespace agent_model {
+
+
+    /**
+     * @brief A classification of the targets, which is built once per step and shared by the model stages
+     * The targets are bucketed by their lane relative to the ego lane (-1, 0, +1) in the order of the input. For the
+     * lanes -2 to +2, the nearest valid target ahead (leader) and behind (follower) is stored. For the lanes beyond,
+     * both are looked up by a scan on request. A target is valid, if it is set (id > 0) and its distance is finite.
+     * Additionally, the set targets located in the junction area (not on the ego path) are listed. Indices refer to the
+     * classified target array (the input array or a bound span). The summary refers to this array and is valid until
+     * the targets change. The lists are reserved for the number of targets in advance (@see reserve()), so classifying
+     * does not allocate memory.
+     * @tparam T The scalar type of the targets
+     */
+    template<typename T>
+    class BasicTargetSummary {
+
+    public:
+
+        static const int LANES = 3; //!< The number of classified lanes (-1, 0, +1)
+        static const int NEIGHBOURS = 2; //!< The range of lanes with nearest targets (-2 to +2)
+        static const unsigned int NONE = std::numeric_limits<unsigned int>::max(); //!< Index for no target
+
+    protected:
+
+        const BasicTarget<T> *_targets = nullptr;       //!< The classified targets
+        unsigned int _n = 0;                            //!< The number of classified targets
+
+        std::vector<unsigned int> _lane[LANES];         //!< The indices of all targets per lane (in input order)
+        unsigned int _leader[2 * NEIGHBOURS + 1]{};     //!< The nearest valid target ahead per lane
+        unsigned int _follower[2 * NEIGHBOURS + 1]{};   //!< The nearest valid target behind per lane
+        std::vector<unsigned int> _junction;            //!< The indices of the targets in the junction area
+
+    public:
+
+        /**
+         * Default constructor. Reserves the lists for NOT targets.
+         */
+        BasicTargetSummary() {
+            reserve(NOT);
+        }
+
+
+        /**
+         * Reserves the lists for the given number of targets
+         * @param n The number of targets
+         */
+        void reserve(unsigned int n) {
+
+            for (auto &l : _lane)
+                l.reserve(n);
+
+            _junction.reserve(n);
+
+        }
+
+
+        /**
+         * Classifies the targets
+         * @param targets The targets
+         * @param n The number of targets
+         */
+        void update(const BasicTarget<T> *targets, unsigned int n) {
+
+            using namespace std;
+
+            _targets = targets;
+            _n = n;
+            _junction.clear();
+
+            for (auto &l : _lane)
+                l.clear();
+
+            for (int l = 0; l < 2 * NEIGHBOURS + 1; ++l) {
+                _leader[l] = NONE;
+                _follower[l] = NONE;
+            }
+
+            for (unsigned int i = 0; i < _n; ++i) {
+
+                auto &t = targets[i];
+
+                // targets in the junction area
+                if (t.id != 0 && t.position != TARGET_NOT_RELEVANT && t.position != TARGET_ON_PATH)
+                    _junction.push_back(i);
+
+                // only the lanes up to the second neighbours are classified
+                if (t.lane < -NEIGHBOURS || t.lane > NEIGHBOURS)
+                    continue;
+
+                // only the ego lane and the neighbouring lanes are bucketed
+                if (t.lane >= -1 && t.lane <= 1)
+                    _lane[t.lane + 1].push_back(i);
+
+                // nearest valid targets (the first one wins if equally distant)
+                if (t.id == 0 || isinf(t.ds))
+                    continue;
+
+                auto l = t.lane + NEIGHBOURS;
+
+                if (t.ds < 0.0) {
+                    if (_follower[l] == NONE || targets[_follower[l]].ds < t.ds)
+                        _follower[l] = i;
+                } else {
+                    if (_leader[l] == NONE || targets[_leader[l]].ds > t.ds)
+                        _leader[l] = i;
+                }
+
+            }
+
+        }
+
+
+        /**
+         * Returns a classified target
+         * @param index The index of the target
+         * @return The target
+         */
+        const BasicTarget<T> &target(unsigned int index) const {
+            return _targets[index];
+        }
+
+
+        /**
+         * Returns the number of classified targets
+         * @return The number of targets
+         */
+        unsigned int size() const {
+            return _n;
+        }
+
+
+        /**
+         * Returns the nearest valid target ahead on a lane
+         * Lanes beyond the second neighbours are not classified and looked up by a scan.
+         * @param lane The lane relative to the ego lane
+         * @return The index of the target (NONE: no target)
+         */
+        unsigned int leader(int lane) const {
+
+            if (lane >= -NEIGHBOURS && lane <= NEIGHBOURS)
+                return _leader[lane + NEIGHBOURS];
+
+            return scan(lane, true);
+
+        }
+
+
+        /**
+         * Returns the nearest valid target behind on a lane
+         * Lanes beyond the second neighbours are not classified and looked up by a scan.
+         * @param lane The lane relative to the ego lane
+         * @return The index of the target (NONE: no target)
+         */
+        unsigned int follower(int lane) const {
+
+            if (lane >= -NEIGHBOURS && lane <= NEIGHBOURS)
+                return _follower[lane + NEIGHBOURS];
+
+            return scan(lane, false);
+
+        }
+
+
+        /**
+         * Returns the indices of all targets on a lane (-1, 0, +1) in input order, including unset targets
+         * @param lane The lane relative to the ego lane
+         * @param size The number of targets on the lane
+         * @return The indices
+         */
+        const unsigned int *lane(int lane, unsigned int &size) const {
+
+            if (lane < -1 || lane > 1) {
+                size = 0;
+                return nullptr;
+            }
+
+            size = (unsigned int) _lane[lane + 1].size();
+            return _lane[lane + 1].data();
+
+        }
+
+
+        /**
+         * Returns the indices of the set targets in the junction area (not on the ego path) in input order
+         * @param size The number of targets
+         * @return The indices
+         */
+        const unsigned int *junction(unsigned int &size) const {
+
+            size = (unsigned int) _junction.size();
+            return _junction.data();
+
+        }
+
+
+    protected:
+
+        /**
+         * Scans the targets for the nearest valid target on a lane, which is not classified
+         * @param lane The lane relative to the ego lane
+         * @param ahead Flag to search ahead (true) or behind (false)
+         * @return The index of the target (NONE: no target)
+         */
+        unsigned int scan(int lane, bool ahead) const {
+
+            using namespace std;
+
+            unsigned int im = NONE;
+            for (unsigned int i = 0; i < _n; ++i) {
+
+                auto &t = _targets[i];
+                if (t.id == 0 || isinf(t.ds) || (t.ds < 0.0) == ahead || t.lane != lane)
+                    continue;
+
+                if (im == NONE || (ahead ? _targets[im].ds > t.ds : _targets[im].ds < t.ds))
+                    im = i;
+
+            }
+
+            return im;
+
+        }
+
+    };
+
+    typedef BasicTargetSummary<double> TargetSummary; //!< The summary of the double targets
+
+
+}
+
+#endif // SIMDRIVER_TARGET_SUMMARY_H
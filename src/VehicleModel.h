@@ -0,0 +1,188 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// VehicleModel.h
+
+
+#ifndef SIMDRIVER_VEHICLE_MODEL_H
+#define SIMDRIVER_VEHICLE_MODEL_H
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include "Interface.h"
+#include "InputTables.h"
+#include "model_collection.h"
+
+template<typename T>
+class BasicAgentModel;
+
+namespace agent_model {
+
+
+    /**
+     * @brief A lightweight vehicle model to close the loop without an external simulator
+     * The model integrates the vehicle state (v, a, s, d, psi, dPsi) from the desired acceleration and curvature of
+     * the agent model with a fixed step size. The longitudinal dynamics are a first-order lag of the acceleration with
+     * limits, the lateral dynamics are a kinematic bicycle model, which drives the desired curvature (limited by the
+     * maximum steering angle). The position is integrated in road coordinates along a reference line with the given
+     * curvature: s is the travelled distance along the reference line, d the lateral offset and psi the yaw angle
+     * relative to the reference line. The state is integrated in the scalar type of the agent model, so a closed loop
+     * with dual numbers gives the sensitivities of the complete trajectory (@see BasicAgentModel).
+     */
+    class VehicleModel {
+
+    public:
+
+        /**
+         * @brief The parameters of the vehicle model
+         */
+        struct Parameters {
+            double wheelBase = 2.8;      //!< The wheel base (in *m*)
+            double steeringMax = 0.6;    //!< The maximum steering angle of the wheels (in *rad*)
+            double aMax = 4.0;           //!< The maximum acceleration (in *m/s^2*)
+            double aMin = -10.0;         //!< The maximum deceleration (in *m/s^2*)
+            double vMax = 70.0;          //!< The maximum velocity (in *m/s*)
+            double tau = 0.0;            //!< The time constant of the acceleration lag (in *s*, 0: no lag)
+        };
+
+
+    protected:
+
+        Parameters _param{}; //!< The parameters
+
+
+    public:
+
+        /**
+         * Default constructor
+         */
+        VehicleModel() = default;
+
+
+        /**
+         * Constructor
+         * @param parameters The parameters
+         */
+        explicit VehicleModel(const Parameters &parameters);
+
+
+        /**
+         * Returns the parameters
+         * @return The parameters
+         */
+        Parameters *getParameters() {
+            return &_param;
+        }
+
+
+        /**
+         * Integrates the vehicle state by one step
+         * @param control The desired values (acceleration and curvature are used)
+         * @param vehicle The vehicle state to be integrated
+         * @param dt The step size (in *s*, must be positive)
+         * @param kappaRoad The curvature of the reference line at the vehicle's position (in *1/m*)
+         */
+        template<typename T>
+        void step(const BasicSubconscious<T> &control, BasicVehicleState<T> &vehicle, double dt,
+                  T kappaRoad = 0.0) const;
+
+
+        /**
+         * Integrates the vehicle state of the agent's input by one step based on the agent's desired values. The
+         * curvature of the reference line is taken from the agent's horizon at the vehicle's position. The other
+         * inputs (horizon, lanes, signals and targets) are not updated.
+         * @param agent The agent
+         * @param dt The step size (in *s*, must be positive)
+         */
+        template<typename T>
+        void step(BasicAgentModel<T> &agent, double dt) const;
+
+    };
+
+
+    template<typename T>
+    void VehicleModel::step(const BasicSubconscious<T> &control, BasicVehicleState<T> &vehicle, double dt,
+                            T kappaRoad) const {
+
+        using namespace std;
+
+        // check step size (the actual acceleration and the yaw rate are derived by dividing by it)
+        if (!(dt > 0.0))
+            throw std::invalid_argument("step size must be positive.");
+
+        // acceleration (first-order lag with limits)
+        T aDes = isfinite(control.a) ? control.a : T(0.0);
+        T a = _param.tau <= 0.0 ? aDes : vehicle.a + (aDes - vehicle.a) * std::min(1.0, dt / _param.tau);
+        a = std::max(T(_param.aMin), std::min(T(_param.aMax), a));
+
+        // velocity (the vehicle does not drive backwards)
+        T v0 = vehicle.v;
+        T v = std::max(T(0.0), std::min(T(_param.vMax), v0 + a * dt));
+
+        // actual acceleration and mean velocity of the step
+        a = (v - v0) / dt;
+        T vm = 0.5 * (v0 + v);
+
+        // curvature (kinematic bicycle model with steering limit)
+        T kappaMax = std::tan(_param.steeringMax) / _param.wheelBase;
+        T kappa = isfinite(control.kappa) ? std::max(-kappaMax, std::min(kappaMax, control.kappa)) : T(0.0);
+
+        // motion in road coordinates
+        T ds = vm * cos(vehicle.psi) / std::max(T(1e-3), 1.0 - vehicle.d * kappaRoad) * dt;
+        T dd = vm * sin(vehicle.psi) * dt;
+        T dPsi = vm * kappa - kappaRoad * ds / dt;
+
+        // set state
+        vehicle.a = a;
+        vehicle.v = v;
+        vehicle.s += ds;
+        vehicle.d += dd;
+        vehicle.psi += dPsi * dt;
+        vehicle.dPsi = dPsi;
+        vehicle.pedal = control.pedal;
+        vehicle.steering = atan(kappa * _param.wheelBase) / _param.steeringMax;
+
+    }
+
+
+    template<typename T>
+    void VehicleModel::step(BasicAgentModel<T> &agent, double dt) const {
+
+        using namespace std;
+
+        auto input = agent.getInput();
+
+        // curvature of the reference line at the vehicle's position (only the set horizon points)
+        auto nh = count(input->countsValid, input->numHorizon, NOH);
+        T kappaRoad = nh < 2 || isinf(input->horizon.ds[1])
+                ? T(0.0) : interpolate<T>(0.0, input->horizon.ds, input->horizon.kappa, nh);
+
+        step(agent.getState()->subconscious, input->vehicle, dt, kappaRoad);
+
+    }
+
+
+}
+
+#endif // SIMDRIVER_VEHICLE_MODEL_H
@@ -28,33 +28,46 @@
 #define SIMDRIVER_VELOCITYHORIZON_H
 
 #include <cmath>
-#include <deque>
 #include <algorithm>
+#include <stdexcept>
 #include "model_collection.h"
+#include "Snapshot.h"
 
 
 namespace agent_model {
 
 
-    /** @brief A class to store the internal horizon */
-    class VelocityHorizon {
+    /**
+     * @brief A class to store the internal horizon
+     * The points are stored in a fixed-size ring buffer, so the horizon can be copied without allocating memory.
+     * The points are placed on a grid of 1 m, which only depends on the values of the positions.
+     * @tparam T The scalar type of the positions and velocities
+     */
+    template<typename T>
+    class BasicVelocityHorizon {
+
+    public:
+
+        static const unsigned int MAX_ELEMENTS = 401; //!< Maximum number of points stored in the horizon
 
     protected:
 
         /** @brief A class store a prediction point */
         struct PredictionPoint {
             size_t i;     //!< Reference index of the point
-            double s;     //!< The longitudinal reference position of the point
-            double ds;    //!< The actual distance to the point
-            double vRule; //!< The planned velocity at the point
-            double vCont; //!< The continuous velocity (e.g. curve speed)
-            double sCont; //!< The continuous measure point
+            T s;     //!< The longitudinal reference position of the point
+            T ds;    //!< The actual distance to the point
+            T vRule; //!< The planned velocity at the point
+            T vCont; //!< The continuous velocity (e.g. curve speed)
+            T sCont; //!< The continuous measure point
         };
 
-        double _offset;
-        double _vMax;
+        T _offset = 0.0;
+        T _vMax = INFINITY;
 
-        std::deque <PredictionPoint> _elements{};
+        size_t _first = 0; //!< Index of the first point in the ring buffer
+        size_t _size = 0;  //!< Number of points in the ring buffer
+        PredictionPoint _elements[MAX_ELEMENTS]{};
 
 
 
@@ -66,17 +79,22 @@ namespace agent_model {
          * @param offset Position offset of the horizon
          * @param noOfElements Number of elements to be stored
          */
-        void init(double offset, unsigned int noOfElements) {
+        void init(T offset, unsigned int noOfElements) {
+
+            // check number of elements
+            if (noOfElements == 0 || noOfElements > MAX_ELEMENTS)
+                throw std::invalid_argument("number of horizon elements must be in [1, MAX_ELEMENTS].");
 
             // set offset
-            _offset = std::floor(offset);
+            _offset = std::floor(static_cast<double>(offset));
 
             // reset elements
-            if (_elements.size() > 0) _elements.clear();
+            _first = 0;
+            _size = noOfElements;
 
             // create points
             for (size_t i = 0; i < noOfElements; ++i)
-                _elements.emplace_back(newPoint(i));
+                _elements[i] = newPoint(i);
 
         }
 
@@ -86,11 +104,14 @@ namespace agent_model {
          * Removes all elements with a distance smaller than zero, except of the first one smaller than zero
          * @param s New reference position
          */
-        void update(double s) {
+        void update(T s) {
 
             size_t i0 = 0; // first element with positive distance
 
-            for (auto &e : _elements) {
+            for (size_t j = 0; j < _size; ++j) {
+
+                // get element
+                auto &e = at(j);
 
                 // recalculate distance
                 e.ds = e.s - s;
@@ -101,7 +122,7 @@ namespace agent_model {
             }
 
             // get reference index of the last element
-            size_t ib = _elements.back().i;
+            size_t ib = at(_size - 1).i;
 
             // remove old element
             for (size_t i = 0; i + 1 < i0; ++i) {
@@ -110,8 +131,8 @@ namespace agent_model {
                 size_t i1 = ib + i + 1;
 
                 // remove from front, add to the back
-                _elements.pop_front();
-                _elements.emplace_back(newPoint(i1));
+                _first = (_first + 1) % MAX_ELEMENTS;
+                at(_size - 1) = newPoint(i1);
 
             }
 
@@ -123,16 +144,16 @@ namespace agent_model {
          * @param s Position to be searched
          * @return Index of the interval
          */
-        unsigned int getIndexBefore(double s) {
+        unsigned int getIndexBefore(T s) {
 
-            double s0 = _elements.at(0).s;
+            T s0 = at(0).s;
 
             if(s <= s0)
                 return 0.0;
-            if(s >= _elements.back().s)
-                return _elements.size() - 1;
+            if(s >= at(_size - 1).s)
+                return _size - 1;
 
-            return (unsigned int) std::floor(s - s0);
+            return (unsigned int) std::floor(static_cast<double>(s - s0));
 
         }
 
@@ -142,16 +163,16 @@ namespace agent_model {
          * @param s Position to be searched
          * @return Index of the interval
          */
-        unsigned int getIndexAfter(double s) {
+        unsigned int getIndexAfter(T s) {
 
-            double s0 = _elements.at(0).s;
+            T s0 = at(0).s;
 
             if(s <= s0)
                 return 0.0;
-            if(s >= _elements.back().s)
-                return _elements.size() - 1;
+            if(s >= at(_size - 1).s)
+                return _size - 1;
 
-            return (unsigned int) std::ceil(s - s0);
+            return (unsigned int) std::ceil(static_cast<double>(s - s0));
 
         }
 
@@ -160,7 +181,7 @@ namespace agent_model {
          * Updates the maximum total velocity
          * @param v Velocity to be set
          */
-        void setMaxVelocity(double v) {
+        void setMaxVelocity(T v) {
 
             _vMax = v;
 
@@ -172,8 +193,8 @@ namespace agent_model {
          */
         void resetSpeedRule() {
 
-            for(auto &e : _elements)
-                e.vRule = INFINITY;
+            for(size_t j = 0; j < _size; ++j)
+                at(j).vRule = INFINITY;
 
         }
 
@@ -184,7 +205,7 @@ namespace agent_model {
          * @param s1 End of the interval
          * @param v Velocity to be set
          */
-        void updateSpeedRuleInInterval(double s0, double s1, double v) {
+        void updateSpeedRuleInInterval(T s0, T s1, T v) {
 
             auto i0 = getIndexBefore(s0);
             auto i1 = getIndexAfter(s1);
@@ -192,7 +213,7 @@ namespace agent_model {
             for (unsigned int i = i0; i <= i1; ++i) {
 
                 // get element
-                auto &e = _elements.at(i);
+                auto &e = at(i);
 
                 // set speed if speed is smaller and point in interval
                 if(e.vRule > v)
@@ -208,11 +229,11 @@ namespace agent_model {
          * @param s Point to be set
          * @param v Velocity to be set
          */
-        void updateContinuousPoint(double s, double v) {
+        void updateContinuousPoint(T s, T v) {
 
             // get index before position
             auto i = getIndexAfter(s);
-            auto &e = _elements.at(i);
+            auto &e = at(i);
 
             if(s > e.sCont) {
 
@@ -232,12 +253,12 @@ namespace agent_model {
          * @param delta A factor shifting the influence over the interval
          * @return The mean value
          */
-        double mean(double s0, double s1, double delta = 1.0) {
+        T mean(T s0, T s1, T delta = 1.0) {
 
             // instantiate
-            double v = 0.0;
-            double vMin = INFINITY;
-            double j = 0;
+            T v = 0.0;
+            T vMin = INFINITY;
+            T j = 0.0;
 
             // get indexes
             auto i0 = getIndexBefore(s0);
@@ -247,7 +268,7 @@ namespace agent_model {
 
                 // get speed and s
                 auto v0 = (std::min)(vMin, getSpeedAt(i));
-                auto s = _elements.at(i).s;
+                auto s = at(i).s;
 
                 // sum up with scaled factor
                 auto f = agent_model::scale(s, s1, s0, delta);
@@ -262,7 +283,85 @@ namespace agent_model {
 
             }
 
-            return v / (double) j;
+            return v / j;
+
+        }
+
+
+        /**
+         * Returns the number of bytes needed to store the horizon in a snapshot
+         * @return Number of bytes
+         */
+        size_t snapshotSize() const {
+
+            return sizeof(_offset) + sizeof(_vMax) + sizeof(_size) + _size * sizeof(PredictionPoint);
+
+        }
+
+
+        /**
+         * Checks the horizon section of a snapshot buffer without restoring it
+         * @param buffer Buffer to be checked
+         * @param available Remaining size of the buffer (in *bytes*)
+         * @return Size of the section (in *bytes*)
+         */
+        static size_t checkSnapshot(const char *buffer, size_t available) {
+
+            size_t size = 0;
+            snapshot::require(sizeof(_offset) + sizeof(_vMax) + sizeof(_size), available);
+            snapshot::read(buffer + sizeof(_offset) + sizeof(_vMax), size);
+
+            // check size
+            if (size == 0 || size > MAX_ELEMENTS)
+                throw std::invalid_argument("snapshot buffer is invalid.");
+
+            auto total = sizeof(_offset) + sizeof(_vMax) + sizeof(_size) + size * sizeof(PredictionPoint);
+            snapshot::require(total, available);
+            return total;
+
+        }
+
+
+        /**
+         * Writes the horizon to the snapshot buffer
+         * @param buffer Buffer to be written to
+         * @return Pointer behind the written data
+         */
+        char *save(char *buffer) const {
+
+            buffer = snapshot::write(buffer, _offset);
+            buffer = snapshot::write(buffer, _vMax);
+            buffer = snapshot::write(buffer, _size);
+
+            // write elements in the order of the horizon
+            for (size_t j = 0; j < _size; ++j)
+                buffer = snapshot::write(buffer, at(j));
+
+            return buffer;
+
+        }
+
+
+        /**
+         * Restores the horizon from the snapshot buffer
+         * @param buffer Buffer to be read from
+         * @return Pointer behind the read data
+         */
+        const char *restore(const char *buffer) {
+
+            buffer = snapshot::read(buffer, _offset);
+            buffer = snapshot::read(buffer, _vMax);
+            buffer = snapshot::read(buffer, _size);
+
+            // check size
+            if (_size == 0 || _size > MAX_ELEMENTS)
+                throw std::invalid_argument("snapshot buffer is invalid.");
+
+            // read elements
+            _first = 0;
+            std::memcpy(_elements, buffer, _size * sizeof(PredictionPoint));
+
+            return buffer + _size * sizeof(PredictionPoint);
 
         }
 
@@ -276,15 +375,39 @@ namespace agent_model {
          * @param i Index
          * @return Minimum speed
          */
-        double getSpeedAt(unsigned int i) {
+        T getSpeedAt(unsigned int i) {
 
             // get speed at index
-            auto &e = _elements.at(i);
+            auto &e = at(i);
             return (std::min)((std::min)(e.vCont, e.vRule), _vMax);
 
         }
 
 
+        /**
+         * Returns the point at the given position of the horizon
+         * @param i Index relative to the first point
+         * @return The point
+         */
+        PredictionPoint &at(size_t i) {
+
+            return _elements[(_first + i) % MAX_ELEMENTS];
+
+        }
+
+
+        /**
+         * Returns the point at the given position of the horizon
+         * @param i Index relative to the first point
+         * @return The point
+         */
+        const PredictionPoint &at(size_t i) const {
+
+            return _elements[(_first + i) % MAX_ELEMENTS];
+
+        }
+
+
         /**
          * Creates a new point with the given index at the given position
          * @param i Index of the point
@@ -292,7 +415,7 @@ namespace agent_model {
          */
         PredictionPoint newPoint(size_t i) {
 
-            double s = _offset + (double) i;
+            T s = _offset + (double) i;
             return PredictionPoint{i, s, INFINITY, INFINITY, INFINITY, s - 1.0};
 
         }
@@ -300,6 +423,8 @@ namespace agent_model {
 
     };
 
+    typedef BasicVelocityHorizon<double> VelocityHorizon; //!< The velocity horizon with double values
+
 
 }
 
@@ -39,9 +39,17 @@
 
 #include <limits>
 #include <cmath>
+#include <algorithm>
+#include <stdexcept>
 
 namespace agent_model {
 
+    /*
+     * The functions are templates over the scalar type T, e.g. double or a dual number (@see Dual.h) to calculate
+     * exact derivatives of the results with respect to the inputs. The scalar type must provide the arithmetic and
+     * comparison operators with double and the functions pow, sqrt, abs, atan2, isinf and isnan (found by ADL).
+     */
+
     /**
      * The reaction based on the current speed and the desired speed. The model is defined in
      * the free part of the IDM model. [1]
@@ -58,25 +66,35 @@ namespace agent_model {
      * @param delta   The parameter \delta (in -)
      * @return Return the cruise scale-down factor
      */
-    double IDMSpeedReaction(double v, double vTarget, double delta);
+    template<typename T>
+    T IDMSpeedReaction(T v, T vTarget, T delta) {
 
+        using namespace std;
 
-    /**
-     * Calculates the reaction on the current speed and the desired speed with respect to the oncoming and local
-     * situation. The local situation is described by the parameter v0, which is the desired reference speed in case
-     * of uninfluenced driving (the desired speed). The oncoming situation is described by
-     *
-     * @param v         The actual velocity
-     * @param vTarget   The local target velocity
-     * @param delta     The delta parameter (@see IDMSpeedReaction)
-     * @param dsStep    The distance to the velocity step
-     * @param vStep     The reference velocity at the velocity step
-     * @param TMax      The maximum prediction time headway
-     * @param deltaP    The intensity parameter for the prediction
-     * @return Returns the reaction value
-     */
-    double speedReaction(double v, double vTarget, double delta, const double *vStep, const double *dsStep, double TMax,
-                         double deltaP);
+        // v must not be negative or inf
+        if (v < 0.0)
+            throw invalid_argument("actual velocity must not be negative.");
+        else if (isinf(v))
+            throw invalid_argument("actual velocity must be finite.");
+
+        // vTarget must not be negative
+        if (vTarget < 0)
+            throw invalid_argument("target velocity must not be negative.");
+
+        // special cases
+        if (vTarget <= 0.0 || v >= 2 * vTarget)
+            return 2.0;
+        else if (isinf(vTarget))
+            return 0.0;
+
+        // calculate result
+        T dv = vTarget - v;
+        T r = pow(1.0 - abs(dv) / vTarget, delta);
+
+        // switch for dv < 0
+        return dv < 0.0 ? 2.0 - r : r;
+
+    }
 
 
     /**
@@ -90,7 +108,41 @@ namespace agent_model {
      * @param s0    Desired distance when stopping (in *m*)
      * @return The resultant acceleration and the scale down factor for cruising
      */
-    double IDMFollowReaction(double ds, double vPre, double v, double T, double s0, double a, double b);
+    template<typename S>
+    S IDMFollowReaction(S ds, S vPre, S v, S T, S s0, S a, S b) {
+
+        using namespace std;
+
+        // v must not be negative or inf
+        if (v < 0.0)
+            throw invalid_argument("actual velocity must not be negative.");
+        else if (isinf(v))
+            throw invalid_argument("actual velocity must be finite.");
+
+        // vTarget must not be negative
+        if (vPre < 0)
+            throw invalid_argument("target velocity must not be negative.");
+
+        // avoid division by inf
+        if (isinf(ds))
+            return 0.0;
+
+        // get rel. velocity and dsStar (IDM)
+        S dv = v - vPre;
+        S dsStar = s0 + v * T + 0.5 * dv * v / sqrt(a * -b);
+
+        // avoid 0/0
+        if (dsStar == 0.0 && ds == 0.0)
+            return 1.0;
+
+        // avoid negative distances
+        if (ds <= 0.0)
+            ds = 0.0;
+
+        // return squared ratio
+        return pow(dsStar / ds, 2.0);
+
+    }
 
 
     /**
@@ -106,7 +158,28 @@ namespace agent_model {
      * @param dTheta The reference angle derivative (will be set by function, for debugging)
      * @return The resultant yaw rate
      */
-    double SalvucciAndGray(double x, double y, double dx, double dy, double P, double D, double &theta, double &dTheta);
+    template<typename T>
+    T SalvucciAndGray(T x, T y, T dx, T dy, T P, T D, T &theta, T &dTheta) {
+
+        using namespace std;
+
+        // avoid problem with x=0, x=inf, ...
+        if (isinf(x) || isinf(y) || y == 0) {
+            theta = 0.0;
+            dTheta = 0.0;
+            return 0.0;
+        }
+
+        // calculate dTheta and Theta
+        if (theta != 0)
+            dTheta = theta - atan2(y, x);
+        theta = atan2(y, x);
+        //dTheta = (y * dx + x * dy) / (x * x + y * y);
+
+        // calculate reaction
+        return P * theta + D * dTheta;
+
+    }
 
 
     /**
@@ -122,12 +195,30 @@ namespace agent_model {
      * @param bc  Reference deceleration (bc >= 0) [m/s^2]
      * @return
      */
-    double IDMOriginal(double v, double v0, double ds, double dv, double T, double s0, double ac, double bc);
+    template<typename S>
+    S IDMOriginal(S v, S v0, S ds, S dv, S T, S s0, S ac, S bc) {
+
+        using namespace std;
+
+        // calculate acceleration
+        S s_star = s0 + v * T + (v * dv / (2.0 * sqrt(ac * bc)));
+        S acc = ac * (1.0 - pow(v / v0, 4) - pow(s_star / ds, 2));
+
+        // check for nan or inf
+        if (isnan(acc) || isinf(acc))
+            acc = 0.0;
+
+        return acc;
+
+    }
 
 
     /**
      * Calculates the safety criterion (safety factor > 0) and the incentive criterion (incentive factor > 0)
      * according to the MOBIL model [3]
+     * The accelerations of the back vehicles are calculated with their own velocities and the desired velocity of the
+     * ego vehicle (the desired velocities of the others are unknown). Missing vehicles are passed with an infinite
+     * distance.
      *
      * @param safety    The safety factor
      * @param incentive The incentive factor
@@ -149,10 +240,80 @@ namespace agent_model {
      * @param aThr      Threshold for accepted acceleration (aThr > 0, e.g. 0.5) [m/s^2]
      * @param p         Politeness factor, allowing to vary the motivation for lane-changing from purely egoistic to more cooperative driving behavior. (p > 0, e.g. 0.8) [-]
      */
-    void
-    MOBILOriginal(double &safety, double &incentive, double v, double v0, double T, double s0, double ac, double bc,
-                  double ds0f, double v0f, double ds1f, double v1f, double ds0b, double v0b, double ds1b, double v1b,
-                  double bSafe, double aThr, double p);
+    template<typename S>
+    void MOBILOriginal(S &safety, S &incentive, S v, S v0, S T, S s0, S ac, S bc, S ds0f, S v0f, S ds1f, S v1f,
+                       S ds0b, S v0b, S ds1b, S v1b, S bSafe, S aThr, S p) {
+
+        S a00m = IDMOriginal<S>(v, v0, ds0f, v - v0f, T, s0, ac, bc);          // acc(M)
+        S a11m = IDMOriginal<S>(v, v0, ds1f, v - v1f, T, s0, ac, bc);          // acc'(M')
+        S a00b = IDMOriginal<S>(v0b, v0, -ds0b, v0b - v, T, s0, ac, bc);           // acc(B)
+        S a01b = IDMOriginal<S>(v1b, v0, ds1f - ds1b, v1b - v1f, T, s0, ac, bc);   // acc(B')
+        S a10b = IDMOriginal<S>(v0b, v0, ds0f - ds0b, v0b - v0f, T, s0, ac, bc);   // acc'(B)
+        S a11b = IDMOriginal<S>(v1b, v0, -ds1b, v1b - v, T, s0, ac, bc);           // acc'(B')
+
+        /*
+         * Original criteria:
+         * a11b > -bSave,                                        // safety criterion
+         * a11m - a00m > p * (a00b + a01b - a10b - a11b) + aThr  // incentive criterion
+         */
+
+        // save safety criterion
+        safety = (a11b + bSafe) / bSafe;
+
+        // return incentive criterion
+        incentive = (a11m - a00m - p * (a00b + a01b - a10b - a11b) - aThr) / aThr;
+
+    }
+
+
+    /**
+     * Calculates the safety and the incentive criterion of the MOBIL model [3] for a batch of target lanes in one
+     * pass (@see MOBILOriginal). The accelerations on the original lane do not depend on the target lane and are
+     * calculated once, so a batch of n lanes takes 3 + 3n instead of 6n evaluations of the IDM.
+     *
+     * @param safety    The safety factors (n elements)
+     * @param incentive The incentive factors (n elements)
+     * @param n         The number of target lanes
+     * @param v         Ego velocity (@see IDMOriginal)
+     * @param v0        Desired ego velocity (@see IDMOriginal)
+     * @param T         Time headway parameter (@see IDMOriginal)
+     * @param s0        Stop distance parameter (@see IDMOriginal)
+     * @param ac        Acceleration (@see IDMOriginal)
+     * @param bc        Deceleration (@see IDMOriginal)
+     * @param ds0f      Distance to the front vehicle on the original lane
+     * @param v0f       Velocity to the front vehicle on the original lane
+     * @param ds0b      Distance to the back vehicle on the original lane
+     * @param v0b       Velocity to the back vehicle on the original lane
+     * @param ds1f      Distances to the front vehicles on the target lanes (n elements)
+     * @param v1f       Velocities to the front vehicles on the target lanes (n elements)
+     * @param ds1b      Distances to the back vehicles on the target lanes (n elements)
+     * @param v1b       Velocities to the back vehicles on the target lanes (n elements)
+     * @param bSafe     Safe deceleration (@see MOBILOriginal)
+     * @param aThr      Threshold for accepted acceleration (@see MOBILOriginal)
+     * @param p         Politeness factor (@see MOBILOriginal)
+     */
+    template<typename S>
+    void MOBILBatch(S *safety, S *incentive, unsigned int n, S v, S v0, S T, S s0, S ac, S bc, S ds0f, S v0f,
+                    S ds0b, S v0b, const S *ds1f, const S *v1f, const S *ds1b, const S *v1b, S bSafe, S aThr, S p) {
+
+        // original lane
+        S a00m = IDMOriginal<S>(v, v0, ds0f, v - v0f, T, s0, ac, bc);          // acc(M)
+        S a00b = IDMOriginal<S>(v0b, v0, -ds0b, v0b - v, T, s0, ac, bc);         // acc(B)
+        S a10b = IDMOriginal<S>(v0b, v0, ds0f - ds0b, v0b - v0f, T, s0, ac, bc); // acc'(B)
+
+        // target lanes
+        for (unsigned int i = 0; i < n; ++i) {
+
+            S a11m = IDMOriginal<S>(v, v0, ds1f[i], v - v1f[i], T, s0, ac, bc);               // acc'(M')
+            S a01b = IDMOriginal<S>(v1b[i], v0, ds1f[i] - ds1b[i], v1b[i] - v1f[i], T, s0, ac, bc); // acc(B')
+            S a11b = IDMOriginal<S>(v1b[i], v0, -ds1b[i], v1b[i] - v, T, s0, ac, bc);              // acc'(B')
+
+            safety[i] = (a11b + bSafe) / bSafe;
+            incentive[i] = (a11m - a00m - p * (a00b + a01b - a10b - a11b) - aThr) / aThr;
+
+        }
+
+    }
 
 
     /**
@@ -167,7 +328,75 @@ namespace agent_model {
      * @param extrapMode 0 = -inf/inf is returned, 1 = is extrapolating, other = returns the first/last value
      * @return Returns the interpolated value.
      */
-    double interpolate(double xx, const double *x, const double *y, unsigned int n, int extrapMode = 1);
+    template<typename T>
+    T interpolate(T xx, const T *x, const T *y, unsigned int n, int extrapMode = 1) {
+
+        using namespace std;
+
+        // instantiate
+        size_t i1 = 0;
+        size_t i0 = n; // last finite value
+
+        for (i1 = 0; i1 < n; ++i1) {
+
+            // ignore inf values
+            if (isinf(x[i1]))
+                continue;
+            else
+                i0 = i1;
+
+            // point before current sample point
+            if (x[i1] > xx)
+                break;
+
+        }
+
+        // reset behind last valid value
+        if (i0 != n && (i1 == n || isinf(x[i1])))
+            i1 = i0 + 1;
+
+        bool e = i1 == n || isinf(x[i1]);
+        bool s = i1 == 0 || isinf(x[i1 - 1]);
+
+        // can not find any solution
+        if (e && abs(x[n - 1] - xx) < 1e-15) {
+
+            return y[n - 1];
+
+        } else if (s && abs(x[0] - xx) < 1e-15) {
+
+            return y[0];
+
+        } else if (s) {
+
+            if (extrapMode == 0)
+                return -1.0 * INFINITY;
+            else if (extrapMode == 1 && i1 != n)
+                i1++;
+            else if (extrapMode == 2)
+                return y[i1];
+
+        } else if (e) {
+
+            if (extrapMode == 0)
+                return INFINITY;
+            else if (extrapMode == 1)
+                i1--;
+            else if (extrapMode == 2)
+                return y[i1 - 1];
+
+        }
+
+        // check validity
+        if (i1 == 0 || i1 == n || x[i1 - 1] >= x[i1])
+            throw std::invalid_argument("interpolation not possible.");
+
+
+        // interpolate linearly
+        i0 = i1 - 1;
+        return y[i0] + (xx - x[i0]) * (y[i1] - y[i0]) / (x[i1] - x[i0]);
+
+    }
 
 
     /**
@@ -176,7 +405,13 @@ namespace agent_model {
      * @param x Input value
      * @return Result
      */
-    double scale(double x);
+    template<typename T>
+    T scale(T x) {
+
+        x = std::max(T(0.0), std::min(T(1.0), x));
+        return 3 * x * x - 2 * x * x * x;
+
+    }
 
 
     /**
@@ -187,7 +422,12 @@ namespace agent_model {
      * @param xMin Minimum value
      * @return Result
      */
-    double linScale(double x, double xMax, double xMin);
+    template<typename T>
+    T linScale(T x, T xMax, T xMin) {
+
+        return std::max(T(0.0), std::min(T(1.0), (x - xMin) / (xMax - xMin)));
+
+    }
 
 
     /**
@@ -199,7 +439,27 @@ namespace agent_model {
      * @param delta Potential factor to push the curve towards the min or max value
      * @return Result
      */
-    double scale(double x, double xMax, double xMin, double delta = 1.0);
+    template<typename T>
+    T scale(T x, T xMax, T xMin, T delta = 1.0) {
+
+        using namespace std;
+
+        // limit delta
+        delta = std::max(T(0.0), delta);
+
+        // step at > 0.0
+        if(delta == 0.0)
+            return x <= xMin ? 0.0 : 1.0;
+
+        // calculate scale
+        T s = scale<T>(linScale<T>(x, xMax, xMin));
+
+        if(delta < 1.0)
+            return 1.0 - pow(1.0 - s, 1.0 / delta); // inverted power
+        else
+            return pow(s, delta); // normal power
+
+    }
 
 
     /**
@@ -211,7 +471,13 @@ namespace agent_model {
      * @param delta Potential factor to push the curve towards the min or max value
      * @return Result
      */
-    double invScale(double x, double xMax, double xMin, double delta = 1.0);
+    template<typename T>
+    T invScale(T x, T xMax, T xMin, T delta = 1.0) {
+
+        using namespace std;
+        return pow(scale<T>((xMax - x) / (xMax - xMin)), delta);
+
+    }
 
 
     /**
@@ -222,7 +488,49 @@ namespace agent_model {
      * @param delta Potential factor to push the curve towards the min or max value
      * @return Result
      */
-    double scaleInf(double x, double xMax, double xMin, double delta = 1.0);
+    template<typename T>
+    T scaleInf(T x, T xMax, T xMin, T delta = 1.0) {
+
+        return 1.0 / invScale<T>(x, xMax, xMin, delta);
+
+    }
+
+
+    /**
+     * Calculates the reaction on the current speed and the desired speed with respect to the oncoming and local
+     * situation. The local situation is described by the parameter v0, which is the desired reference speed in case
+     * of uninfluenced driving (the desired speed). The oncoming situation is described by
+     *
+     * @param v         The actual velocity
+     * @param vTarget   The local target velocity
+     * @param delta     The delta parameter (@see IDMSpeedReaction)
+     * @param dsStep    The distance to the velocity step
+     * @param vStep     The reference velocity at the velocity step
+     * @param TMax      The maximum prediction time headway
+     * @param deltaP    The intensity parameter for the prediction
+     * @return Returns the reaction value
+     */
+    template<typename T>
+    T speedReaction(T v, T vTarget, T delta, const T *vStep, const T *dsStep, T TMax, T deltaP) {
+
+        // calculate local reaction
+        T local = IDMSpeedReaction(v, vTarget, delta);
+
+        // max distance
+        T dsMax = v * TMax;
+
+        // calculate factors
+        T f0 = scale<T>(dsStep[0], dsMax, 0.0, deltaP);
+        T f1 = scale<T>(dsStep[1], dsMax, 0.0, deltaP);
+
+        // calculate reaction
+        T r0 = IDMSpeedReaction(v, vStep[0], delta);
+        T r1 = IDMSpeedReaction(v, vStep[1], delta);
+
+        // calculate sum of reaction
+        return f0 * f1 * local + (1.0 - f0) * r0 + (1.0 - f1) * r1;
+
+    }
 
 
 }
@@ -0,0 +1,82 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// DualKernelTest.cpp
+
+#include <cmath>
+#include <cstdio>
+#include "model_collection.h"
+#include "Dual.h"
+
+using namespace agent_model;
+
+
+/**
+ * Follow reaction of the IDM (@see IDMFollowReaction()) for the given time headway, acceleration and velocity
+ */
+template<typename S>
+S follow(S T, S a, S v) {
+
+    return IDMFollowReaction<S>(30.0, 8.0, v, T, 2.0, a, -2.0);
+
+}
+
+
+/**
+ * Compares the derivatives of a kernel, evaluated with dual numbers, with central finite differences
+ */
+int main() {
+
+    typedef Dual<3> D;
+
+    const double x[3] = {1.8, 2.0, 10.0};
+    const double h = 1e-6;
+
+    // evaluate with dual numbers (derivatives with respect to T, a and v)
+    D r = follow<D>(D::variable(x[0], 0), D::variable(x[1], 1), D::variable(x[2], 2));
+
+    // the value must be identical to the double evaluation
+    int failed = 0;
+    if (r.value() != follow<double>(x[0], x[1], x[2])) {
+        std::printf("value: %.12f != %.12f\n", r.value(), follow<double>(x[0], x[1], x[2]));
+        failed++;
+    }
+
+    // compare the derivatives with central finite differences
+    for (unsigned int i = 0; i < 3; ++i) {
+
+        double xp[3] = {x[0], x[1], x[2]}, xm[3] = {x[0], x[1], x[2]};
+        xp[i] += h;
+        xm[i] -= h;
+
+        double fd = (follow<double>(xp[0], xp[1], xp[2]) - follow<double>(xm[0], xm[1], xm[2])) / (2.0 * h);
+        if (std::abs(r.derivative(i) - fd) > 1e-5 * std::max(1.0, std::abs(fd))) {
+            std::printf("derivative %u: %.8f != %.8f\n", i, r.derivative(i), fd);
+            failed++;
+        }
+
+    }
+
+    return failed == 0 ? 0 : 1;
+
+}
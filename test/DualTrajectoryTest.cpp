@@ -0,0 +1,164 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// DualTrajectoryTest.cpp
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include "AgentModelImpl.h"
+#include "VehicleModel.h"
+#include "DefaultParameters.h"
+#include "Dual.h"
+
+using namespace agent_model;
+
+
+/**
+ * Approaches a slower lead vehicle on a straight single-lane road in a closed loop with the vehicle model and returns
+ * the travelled distance and the velocity of the ego vehicle after the given time
+ * @param vComfort The comfortable velocity of the driver (in *m/s*)
+ * @param timeHeadway The time headway of the driver (in *s*)
+ * @param time The simulated time (in *s*)
+ * @param s The travelled distance (in *m*)
+ * @param v The velocity (in *m/s*)
+ */
+template<typename S>
+void trajectory(S vComfort, S timeHeadway, double time, S &s, S &v) {
+
+    const double dt = 0.1;
+
+    BasicAgentModel<S> agent;
+    defaultParameters(*agent.getParameters());
+    agent.getParameters()->velocity.vComfort = vComfort;
+    agent.getParameters()->follow.timeHeadway = timeHeadway;
+
+    auto &in = *agent.getInput();
+    in.vehicle.v = 15.0;
+    in.vehicle.maneuver = STRAIGHT;
+    in.vehicle.dsIntersection = INFINITY;
+
+    // straight horizon
+    for (unsigned int i = 0; i < NOH; ++i) {
+        in.horizon.ds[i] = 5.0 * i - 5.0;
+        in.horizon.x[i] = in.horizon.ds[i];
+        in.horizon.egoLaneWidth[i] = 3.5;
+    }
+
+    in.horizon.destinationPoint = -1.0;
+
+    // single lane
+    in.lanes[0].width = 3.5;
+    in.lanes[0].route = 1e4;
+    in.lanes[0].closed = INFINITY;
+    in.lanes[0].access = ACC_ACCESSIBLE;
+
+    // lead vehicle with constant velocity
+    auto &lead = in.targets[0];
+    lead.id = 1;
+    lead.v = 10.0;
+    lead.size = {2.0, 5.0};
+    lead.dsIntersection = INFINITY;
+    lead.priority = TARGET_PRIORITY_NOT_SET;
+    lead.position = TARGET_NOT_RELEVANT;
+
+    in.numHorizon = NOH;
+    in.numLanes = 1;
+    in.numTargets = 1;
+    in.numSignals = 0;
+    in.countsValid = true;
+
+    agent.init();
+
+    VehicleModel vehicle;
+    S sLead = 40.0;
+    for (double t = 0.0; t < time - 0.5 * dt; t += dt) {
+
+        lead.ds = sLead - in.vehicle.s;
+
+        agent.step(t);
+        vehicle.step(agent, dt);
+
+        sLead += lead.v * dt;
+
+    }
+
+    s = in.vehicle.s;
+    v = in.vehicle.v;
+
+}
+
+
+/**
+ * Compares the sensitivities of a closed-loop trajectory of the agent model, evaluated with dual numbers, with central
+ * finite differences of the agent model with double values
+ */
+int main() {
+
+    typedef Dual<2> D;
+
+    const double x[2] = {30.0, 1.8};
+    const double h = 1e-6;
+    const double time = 20.0;
+
+    // evaluate with dual numbers (derivatives with respect to vComfort and timeHeadway)
+    D s, v;
+    trajectory<D>(D::variable(x[0], 0), D::variable(x[1], 1), time, s, v);
+
+    // the values must be identical to the evaluation of AgentModel
+    double s0, v0;
+    trajectory<double>(x[0], x[1], time, s0, v0);
+
+    int failed = 0;
+    if (s.value() != s0 || v.value() != v0) {
+        std::printf("values: %.12f, %.12f != %.12f, %.12f\n", s.value(), v.value(), s0, v0);
+        failed++;
+    }
+
+    // compare the derivatives with central finite differences
+    for (unsigned int i = 0; i < 2; ++i) {
+
+        double xp[2] = {x[0], x[1]}, xm[2] = {x[0], x[1]};
+        xp[i] += h;
+        xm[i] -= h;
+
+        double sp, vp, sm, vm;
+        trajectory<double>(xp[0], xp[1], time, sp, vp);
+        trajectory<double>(xm[0], xm[1], time, sm, vm);
+
+        double fs = (sp - sm) / (2.0 * h);
+        double fv = (vp - vm) / (2.0 * h);
+
+        std::printf("variable %u: ds = %.6f (%.6f), dv = %.6f (%.6f)\n", i, s.derivative(i), fs, v.derivative(i), fv);
+
+        if (!(std::abs(s.derivative(i) - fs) <= 1e-4 * std::max(1.0, std::abs(fs)))
+            || !(std::abs(v.derivative(i) - fv) <= 1e-4 * std::max(1.0, std::abs(fv)))) {
+            std::printf("derivatives of variable %u do not match.\n", i);
+            failed++;
+        }
+
+    }
+
+    return failed == 0 ? 0 : 1;
+
+}
@@ -0,0 +1,89 @@
+// Copyright (c) 2026 Institute for Automotive Engineering (ika), RWTH Aachen University. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by the SimDriver contributors on 2026-10-18.
+// Contributors:
+//
+// MOBILLaneChangeRateTest.cpp
+
+#include <cstddef>
+#include <cstdio>
+#include "RingRoad.h"
+#include "DefaultParameters.h"
+
+using namespace agent_model;
+
+
+/**
+ * Runs heterogeneous drivers with MOBIL lane changes on a ring road and returns the lane changes per vehicle and hour
+ */
+double laneChangeRate(unsigned int n, unsigned int lanes, double length, unsigned int steps) {
+
+    RingRoad::Parameters road;
+    road.lanes = lanes;
+    road.length = length;
+    road.mobil = true;
+
+    Parameters base{};
+    defaultParameters(base);
+
+    Population population(road.seed);
+    population.addVariable(offsetof(Parameters, velocity.vComfort), {DIST_NORMAL, 30.0, 3.0, 20.0, 40.0});
+    population.addVariable(offsetof(Parameters, follow.timeHeadway), {DIST_NORMAL, 1.8, 0.3, 1.0, 3.0});
+
+    RingRoad ring;
+    ring.init(road, base, n, &population);
+
+    // warm-up
+    for (unsigned int i = 0; i < steps / 10; ++i)
+        ring.step();
+
+    ring.resetStatistics();
+    for (unsigned int i = steps / 10; i < steps; ++i)
+        ring.step();
+
+    auto st = ring.statistics();
+    return (double) st.laneChanges / n / (st.time / 3600.0);
+
+}
+
+
+/**
+ * Checks the lane-change rate of MOBIL drivers at low density. Drivers, which change back and forth between lanes
+ * (e.g. towards lanes without reported targets), change lanes several hundred times per hour.
+ */
+int main() {
+
+    int failed = 0;
+
+    // 10 veh/km on 2 and 3 lanes
+    for (unsigned int lanes = 2; lanes <= 3; ++lanes) {
+
+        double rate = laneChangeRate(30, lanes, 3000.0, 3000);
+        std::printf("lanes: %u, lane changes: %.1f 1/(veh h)\n", lanes, rate);
+
+        if (rate > 100.0)
+            failed++;
+
+    }
+
+    return failed == 0 ? 0 : 1;
+
+}